@@ -0,0 +1,62 @@
+// ============================================================================
+// bench_checkpoint.cpp - Checkpoint Save / Load Cost vs State Size
+// ============================================================================
+// Registers 16 blocks totalling 1, 16 and 256 MiB and reports:
+//   - snapshot: the save() call itself, i.e. what the frame thread pays
+//   - write:    save() until the writer has renamed the file into place
+//   - open:     CheckpointFile::open() (mapping + header/table checks)
+//   - restore:  copying every block back into the registered state
+// open should stay flat as the state grows; restore and snapshot are copies.
+
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "core/Checkpoint.hpp"
+#include "core/Timer.hpp"
+
+int main() {
+    constexpr size_t BLOCKS = 16;
+    constexpr int OPENS = 200;
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "bench_checkpoint";
+    std::filesystem::remove_all(dir);
+
+    for (size_t megabytes : {1u, 16u, 256u}) {
+        size_t perBlock = (megabytes << 20) / BLOCKS / sizeof(uint64_t);
+        std::vector<std::vector<uint64_t>> state(BLOCKS, std::vector<uint64_t>(perBlock));
+        for (size_t b = 0; b < BLOCKS; ++b) {
+            for (size_t i = 0; i < perBlock; ++i) state[b][i] = b * perBlock + i;
+        }
+
+        Checkpointer checkpoints;
+        for (size_t b = 0; b < BLOCKS; ++b) checkpoints.addVector("block" + std::to_string(b), state[b]);
+        std::string path = (dir / ("state_" + std::to_string(megabytes) + ".ckpt")).string();
+
+        // First save grows the image buffer; time the second (the steady state)
+        checkpoints.save(path, {});
+        checkpoints.waitForWrites();
+        Timer timer;
+        checkpoints.save(path, {});
+        double snapshotMs = timer.elapsed() * 1000.0;
+        checkpoints.waitForWrites();
+        double writeMs = timer.elapsed() * 1000.0;
+
+        CheckpointFile file;
+        timer.rest();
+        for (int i = 0; i < OPENS; ++i) file.open(path);
+        double openUs = timer.elapsed() * 1e6 / OPENS;
+
+        timer.rest();
+        bool restored = checkpoints.restore(file);
+        double restoreMs = timer.elapsed() * 1000.0;
+
+        fmt::print("{:4} MiB: snapshot {:8.2f} ms  write {:8.2f} ms  open {:7.1f} us  restore {:8.2f} ms{}\n",
+                   megabytes, snapshotMs, writeMs, openUs, restoreMs, restored ? "" : "  (FAILED)");
+    }
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
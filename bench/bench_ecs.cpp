@@ -0,0 +1,131 @@
+// ============================================================================
+// bench_ecs.cpp - Fixed-Tick Iteration over 1M Entities
+// ============================================================================
+// One "tick" integrates Position += Velocity * dt over 1M entities spread
+// across two archetypes (half also carry Health), three ways:
+//   - chunk query: World::forEachChunk, plain arrays per 16 KiB chunk
+//   - each():      World::each, one callback per entity
+//   - raw SoA:     two std::vector<float> pairs, the ceiling
+// then the cost of applying a tick's worth of deferred commands.
+
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "core/Timer.hpp"
+#include "ecs/CommandBuffer.hpp"
+#include "ecs/World.hpp"
+
+namespace {
+
+struct Position {
+    float x, y, z;
+};
+
+struct Velocity {
+    float x, y, z;
+};
+
+struct Health {
+    int32_t value;
+};
+
+constexpr size_t ENTITIES = 1'000'000;
+constexpr int TICKS = 100;
+constexpr float DT = 1.0f / 60.0f;
+
+void report(const char* name, double seconds, float checksum) {
+    double perTick = seconds / TICKS;
+    fmt::print("{:<12} {:7.3f} ms/tick  {:5.2f} ns/entity  (checksum {:.1f})\n", name, perTick * 1e3,
+               perTick * 1e9 / static_cast<double>(ENTITIES), static_cast<double>(checksum));
+}
+
+}  // namespace
+
+int main() {
+    World world;
+    for (size_t i = 0; i < ENTITIES; ++i) {
+        float f = static_cast<float>(i % 1024);
+        if (i % 2) {
+            world.create(Position{f, 0, 0}, Velocity{1, f, 0});
+        } else {
+            world.create(Position{f, 0, 0}, Velocity{1, f, 0}, Health{100});
+        }
+    }
+    fmt::print("{} entities, {} archetypes\n", world.size(), world.archetypeCount());
+
+    // Chunk query (tick -1 is an untimed warm-up, as for each variant)
+    Timer timer;
+    for (int t = -1; t < TICKS; ++t) {
+        if (t == 0) timer.rest();
+        world.forEachChunk<Position, const Velocity>([](size_t n, Position* p, const Velocity* v) {
+            for (size_t i = 0; i < n; ++i) {
+                p[i].x += v[i].x * DT;
+                p[i].y += v[i].y * DT;
+                p[i].z += v[i].z * DT;
+            }
+        });
+    }
+    double chunkSeconds = timer.elapsed();
+    float checksum = 0.0f;
+    world.each<const Position>([&checksum](const Position& p) { checksum += p.x; });
+    report("chunk query", chunkSeconds, checksum);
+
+    // Per-entity callback
+    for (int t = -1; t < TICKS; ++t) {
+        if (t == 0) timer.rest();
+        world.each<Position, const Velocity>([](Position& p, const Velocity& v) {
+            p.x += v.x * DT;
+            p.y += v.y * DT;
+            p.z += v.z * DT;
+        });
+    }
+    double eachSeconds = timer.elapsed();
+    checksum = 0.0f;
+    world.each<const Position>([&checksum](const Position& p) { checksum += p.x; });
+    report("each()", eachSeconds, checksum);
+
+    // Raw SoA baseline
+    std::vector<Position> positions(ENTITIES);
+    std::vector<Velocity> velocities(ENTITIES);
+    for (size_t i = 0; i < ENTITIES; ++i) {
+        float f = static_cast<float>(i % 1024);
+        positions[i] = {f, 0, 0};
+        velocities[i] = {1, f, 0};
+    }
+    for (int t = -1; t < TICKS; ++t) {
+        if (t == 0) timer.rest();
+        Position* p = positions.data();
+        const Velocity* v = velocities.data();
+        for (size_t i = 0; i < ENTITIES; ++i) {
+            p[i].x += v[i].x * DT;
+            p[i].y += v[i].y * DT;
+            p[i].z += v[i].z * DT;
+        }
+    }
+    double rawSeconds = timer.elapsed();
+    checksum = 0.0f;
+    for (const Position& p : positions) checksum += p.x;
+    report("raw SoA", rawSeconds, checksum);
+    fmt::print("chunk query / raw: {:.2f}x\n", chunkSeconds / rawSeconds);
+
+    // Deferred structural changes: 1% of entities gain or lose Health per tick
+    CommandBuffer commands;
+    timer.rest();
+    for (int t = 0; t < TICKS; ++t) {
+        size_t i = 0;
+        world.each<const Position>([&](Entity e, const Position&) {
+            if (i++ % 100 != static_cast<size_t>(t) % 100) return;
+            if (world.has<Health>(e)) {
+                commands.remove<Health>(e);
+            } else {
+                commands.add(e, Health{100});
+            }
+        });
+        commands.apply(world);
+    }
+    fmt::print("{:<12} {:7.3f} ms/tick  ({} changes/tick, query included)\n", "commands",
+               timer.elapsed() / TICKS * 1e3, ENTITIES / 100);
+    return 0;
+}
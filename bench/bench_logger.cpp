@@ -0,0 +1,112 @@
+// ============================================================================
+// bench_logger.cpp - Frame Time with 1M Log Messages per Second
+// ============================================================================
+// Runs 2000 simulated 1 ms frames: ~300 us of work, then sleep to the next
+// frame boundary. Three modes:
+//   - quiet:  no logging
+//   - async:  1000 messages per frame (1M/s) through Logger
+//   - sync:   the same messages with fmt::print to a file, on the frame
+// and reports the hot-path cost per message and the frame's busy time
+// (work + logging, not the sleep) at p50 / p99 / max.
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#include "core/Logger.hpp"
+#include "core/Timer.hpp"
+
+namespace {
+
+constexpr int FRAMES = 2000;
+constexpr int MESSAGES_PER_FRAME = 1000;
+constexpr double FRAME_SECONDS = 0.001;
+constexpr double WORK_SECONDS = 0.0003;
+
+enum class Mode { Quiet, Async, Sync };
+
+double percentile(std::vector<double> values, double fraction) {
+    size_t index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+// Stand-in for simulation and UI work: spins for a fixed time
+uint64_t work(double seconds) {
+    Timer timer;
+    uint64_t x = 1;
+    while (timer.elapsed() < seconds) {
+        for (int i = 0; i < 64; ++i) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return x;
+}
+
+void run(Mode mode, const char* name, const std::filesystem::path& dir) {
+    std::FILE* syncFile = nullptr;
+    if (mode == Mode::Sync) syncFile = std::fopen((dir / "sync.log").string().c_str(), "wb");
+
+    std::vector<double> busy;
+    busy.reserve(FRAMES);
+    double logSeconds = 0.0;
+    uint64_t sink = 0;
+    auto next = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        Timer frameTimer;
+        sink ^= work(WORK_SECONDS);
+
+        Timer logTimer;
+        for (int i = 0; i < MESSAGES_PER_FRAME; ++i) {
+            if (mode == Mode::Async) {
+                logDebug("frame {} entity {} pos {:.3f} state {}", frame, i, static_cast<double>(i) * 0.5, "moving");
+            } else if (mode == Mode::Sync) {
+                fmt::print(syncFile, "frame {} entity {} pos {:.3f} state {}\n", frame, i,
+                           static_cast<double>(i) * 0.5, "moving");
+            }
+        }
+        logSeconds += logTimer.elapsed();
+        busy.push_back(frameTimer.elapsed() * 1000.0);
+
+        next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(FRAME_SECONDS));
+        std::this_thread::sleep_until(next);
+    }
+    if (syncFile) std::fclose(syncFile);
+
+    double perMessageNs = mode == Mode::Quiet
+                              ? 0.0
+                              : logSeconds * 1e9 / (static_cast<double>(FRAMES) * MESSAGES_PER_FRAME);
+    fmt::print("{:<6} {:6.1f} ns/msg  busy p50 {:.3f} ms  p99 {:.3f} ms  max {:.3f} ms  (sink {:x})\n", name,
+               perMessageNs, percentile(busy, 0.50), percentile(busy, 0.99),
+               *std::max_element(busy.begin(), busy.end()), sink & 0xF);
+}
+
+}  // namespace
+
+int main() {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "bench_logger";
+    std::filesystem::remove_all(dir);
+
+    run(Mode::Quiet, "quiet", dir);
+    {
+        LoggerConfig config;
+        config.path = (dir / "async.log").string();
+        config.maxFileBytes = 64 * 1024 * 1024;
+        config.ringBytes = 4 * 1024 * 1024;
+        config.consoleLevel = LogLevel::Off;
+        Logger logger(config);
+        Logger::setGlobal(&logger);
+        run(Mode::Async, "async", dir);
+        logger.flush();
+        fmt::print("       written {}  dropped {}\n", logger.written(), logger.dropped());
+    }
+    run(Mode::Sync, "sync", dir);
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
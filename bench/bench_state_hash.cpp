@@ -0,0 +1,46 @@
+// ============================================================================
+// bench_state_hash.cpp - StateHasher Throughput
+// ============================================================================
+// Hashes a 64 MiB buffer repeatedly and reports GB/s, plus the per-tick cost
+// of hashing DemoSimulation's state at a few particle counts.
+
+#include <fmt/core.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "core/Timer.hpp"
+#include "core/StateHash.hpp"
+#include "sim/DemoSimulation.hpp"
+
+int main() {
+    constexpr size_t BYTES = size_t{64} << 20;
+    constexpr int ROUNDS = 8;
+
+    std::vector<unsigned char> data(BYTES);
+    for (size_t i = 0; i < BYTES; ++i) data[i] = static_cast<unsigned char>(i * 31);
+
+    uint64_t sink = 0;
+    Timer timer;
+    for (int r = 0; r < ROUNDS; ++r) {
+        sink ^= StateHasher::hash(data.data(), data.size(), static_cast<uint64_t>(r));
+    }
+    double seconds = timer.lap();
+    fmt::print("StateHasher: {:.2f} GB/s (sink {:x})\n",
+               static_cast<double>(BYTES) * ROUNDS / seconds / 1e9, sink);
+
+    for (size_t particles : {10'000u, 100'000u, 1'000'000u}) {
+        DemoSimulationConfig config;
+        config.particles = particles;
+        DemoSimulation sim(config);
+        std::array<uint64_t, DemoSimulation::SUBSYSTEMS.size()> hashes{};
+
+        constexpr int TICKS = 100;
+        timer.rest();
+        for (int i = 0; i < TICKS; ++i) sim.hashState(hashes);
+        fmt::print("hashState, {:>9} particles: {:8.1f} us/tick\n", particles,
+                   timer.elapsed() * 1e6 / TICKS);
+    }
+    return 0;
+}
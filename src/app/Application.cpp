@@ -3,6 +3,8 @@
 // ============================================================================
 
 #include "Application.hpp"
+#include "../core/AllocationCounter.hpp"
+#include "../core/Logger.hpp"
 #include <imgui.h>
 
 // ============================================================================
@@ -34,6 +36,36 @@ void Application::registerCommands() {
         [this]() { showSettingsWindow_ = !showSettingsWindow_; }
     });
     
+    commandPalette_.registerCommand({
+        "Toggle Timing Panel",
+        "",
+        [this]() { showTimingWindow_ = !showTimingWindow_; }
+    });
+
+    commandPalette_.registerCommand({
+        "Pause / Resume Simulation",
+        "",
+        [this]() { timeController_.togglePause(); }
+    });
+
+    commandPalette_.registerCommand({
+        "Toggle Turbo Mode",
+        "",
+        [this]() { timeController_.toggleTurbo(); }
+    });
+
+    commandPalette_.registerCommand({
+        "Save Checkpoint",
+        "",
+        [this]() { saveCheckpoint(); }
+    });
+
+    commandPalette_.registerCommand({
+        "Load Checkpoint",
+        "",
+        [this]() { loadCheckpoint(); }
+    });
+
     commandPalette_.registerCommand({
         "Exit Application",
         "Cmd+Q",
@@ -41,18 +73,100 @@ void Application::registerCommands() {
     });
 }
 
+// ============================================================================
+// Update - Called Every Frame, Before Render
+// ============================================================================
+
+void Application::update(double frameSeconds) {
+    // frameSeconds closes the previous frame: judge it against the median
+    // before it's pushed (a hitch shouldn't raise its own bar)
+    flightRecorder_.endFrame(frameSeconds, ticksThisFrame_, frametimeHistory_.median());
+    frametimeHistory_.push(static_cast<float>(frameSeconds * 1000.0));
+    if (perfCounters_.available()) samplePerfFrame(frameSeconds);
+
+    // End of this frame's slice of wall time, in the input stamps' timebase.
+    // Each tick takes the events that happened before its share of it.
+    double frameTime = inputQueue_.now();
+    bool realTime = !timeController_.isPaused() && !timeController_.isTurbo();
+
+    auto tick = [this, frameTime, realTime](double dt) {
+        PerfScope perf(perfCounters_, perfZones_.open(perfTickZone_));
+        Timer tickTimer;
+        double windowEnd = realTime ? tickWindowEnd(frameTime, gameLoop_.accumulator(), dt,
+                                                    timeController_.getTimeScale())
+                                    : frameTime;
+        inputQueue_.deliverUntil(windowEnd, [this](const InputEvent& event) { handleInput(event); });
+        fixedUpdate(dt);
+        commands_.apply(world_);  // Structural changes land between ticks
+        transformPublisher_.publish(world_, renderState_);
+        double seconds = tickTimer.elapsed();
+        loopMetrics_.recordTick(seconds);
+        flightRecorder_.recordZone("fixedUpdate", seconds);
+    };
+
+    Timer updateTimer;
+    int ticks = 0;
+    if (timeController_.isTurbo()) {
+        ticks = gameLoop_.advanceTurbo(frameSeconds, TURBO_SLICE_SECONDS, tick);
+        renderThisFrame_ = turboRenderDecimator_.shouldRender(frameSeconds);
+    } else {
+        ticks = gameLoop_.advance(frameSeconds, tick);
+        turboRenderDecimator_.reset();
+        renderThisFrame_ = true;
+    }
+    ticksThisFrame_ = static_cast<uint32_t>(ticks);
+    // Input while paused never reaches a tick; don't replay it on resume
+    if (ticks == 0 && timeController_.isPaused()) inputQueue_.discardUntil(frameTime);
+    flightRecorder_.recordPhase(FramePhase::Update, updateTimer.elapsed());
+
+    loopMetrics_.recordFrame(frameSeconds);
+    LoopMetricsSnapshot& metrics = loopMetrics_.snapshot();
+    metrics.droppedSeconds = gameLoop_.droppedTime();
+    metrics.paused = timeController_.isPaused();
+    metrics.timeScale = timeController_.getTimeScale();
+    metrics.allocations = allocation_counter::allocations();
+    metrics.liveAllocations = metrics.allocations - allocation_counter::deallocations();
+
+    if (metricsServer_) {
+        metricsServer_->publish(metrics);  // Lock-free handoff, never waits on a scrape
+    }
+
+    timingStatus_.store(captureTimingStatus(flightRecorder_.frame(),
+                                            static_cast<float>(frameSeconds * 1000.0),
+                                            frametimeHistory_, timeController_, gameLoop_));
+}
+
+void Application::handleInput(const InputEvent& event) {
+    // The shell's simulation has nothing to steer yet; this is where a
+    // game applies input, on the tick the event actually happened in
+    (void)event;
+}
+
+void Application::fixedUpdate(double dt) {
+    (void)dt;
+
+    // Timers run on simulation ticks, so they freeze while paused and
+    // fire once per tick even when several ticks run in one frame
+    timers_.advance();
+}
+
 // ============================================================================
 // Render - Called Every Frame
 // ============================================================================
 
 void Application::render() {
+    PerfScope perf(perfCounters_, perfZones_.open(perfUiZone_));
+
+    // Draw positions for this frame: between the last two ticks
+    renderState_.interpolate(static_cast<float>(gameLoop_.alpha()), interpolated_);
+
     // Step 1: Render the dockspace (full-window docking area)
     // This MUST come first so other windows can dock into it
     dockSpace_.render();
     
     // Step 2: Render the menu bar
     // Pass references so menu bar can toggle our state
-    menuBar_.render(showDemoWindow_, showSettingsWindow_, shouldQuit_);
+    menuBar_.render(showDemoWindow_, showSettingsWindow_, showTimingWindow_, shouldQuit_);
     
     // Step 3: Render the command palette (if open)
     commandPalette_.render();
@@ -67,6 +181,9 @@ void Application::render() {
     if (showSettingsWindow_) {
         renderSettingsWindow();
     }
+
+    timingPanel_.render(showTimingWindow_, timeController_, gameLoop_, frametimeHistory_,
+                        inputQueue_, submitToPresent_, perfCounters_, perfZones_, turboRenderDecimator_);
 }
 
 // ============================================================================
@@ -116,8 +233,15 @@ void Application::renderSettingsWindow() {
 // ============================================================================
 
 void Application::loadSettings(const std::string& path) {
+    readSettings(path);
+    applySettings();
+}
+
+void Application::readSettings(const std::string& path) {
     settingsManager_.load(path);
-    
+}
+
+void Application::applySettings() {
     // Apply loaded settings
     Settings& settings = settingsManager_.get();
     showDemoWindow_ = settings.showDemoWindow;
@@ -140,6 +264,94 @@ void Application::saveSettings(const std::string& path) {
     settingsManager_.save(path);
 }
 
+// ============================================================================
+// Checkpoints
+// ============================================================================
+
+bool Application::saveCheckpoint() {
+    // Only the copy happens here; the writer thread does the I/O
+    if (!checkpoints_.save(checkpointPath_, captureLoopState(gameLoop_, timeController_))) {
+        logWarn("Checkpoint skipped: the previous one is still being written");
+        return false;
+    }
+    double seconds = checkpoints_.lastSnapshotSeconds();
+    flightRecorder_.recordZone("checkpoint", seconds);
+    if (seconds > FRAME_BUDGET_SECONDS) {
+        logWarn("Checkpoint snapshot took {:.1f} ms, over the {:.1f} ms frame budget", seconds * 1000.0,
+                FRAME_BUDGET_SECONDS * 1000.0);
+    }
+    logInfo("Checkpoint at tick {} -> {}", gameLoop_.tick(), checkpointPath_);
+    return true;
+}
+
+bool Application::loadCheckpoint() {
+    CheckpointFile file;
+    if (!file.open(checkpointPath_)) {
+        logWarn("Checkpoint not loaded: {}", file.error());
+        return false;
+    }
+    // Check everything that can fail before changing anything. The world,
+    // the command buffer and the timers aren't in the checkpoint: loading
+    // over them would mix this run's state into the saved one.
+    if (world_.size() > 0 || !commands_.empty() || !timers_.empty()) {
+        logWarn("Checkpoint not loaded: {} entities, {} queued commands and {} timers aren't checkpointed",
+                world_.size(), commands_.size(), timers_.size());
+        return false;
+    }
+    if (file.loop().fixedDt != gameLoop_.fixedDt()) {
+        logWarn("Checkpoint not loaded: saved with a {} s timestep, running {} s", file.loop().fixedDt,
+                gameLoop_.fixedDt());
+        return false;
+    }
+    if (!checkpoints_.restore(file)) {
+        logWarn("Checkpoint not loaded: {}", checkpoints_.error());
+        return false;
+    }
+    restoreLoopState(file.loop(), gameLoop_, timeController_);
+
+    // Input queued before the jump belongs to no tick of the resumed run
+    inputQueue_.discardUntil(inputQueue_.now());
+    logInfo("Resumed at tick {} from {}", gameLoop_.tick(), checkpointPath_);
+    return true;
+}
+
+// ============================================================================
+// Metrics Endpoint
+// ============================================================================
+
+bool Application::startMetricsServer(uint16_t port) {
+    auto server = std::make_unique<MetricsServer>();
+    if (!server->start(port)) {
+        return false;
+    }
+    metricsServer_ = std::move(server);
+    return true;
+}
+
+// ============================================================================
+// Hardware Counters
+// ============================================================================
+
+bool Application::enablePerfCounters() {
+    if (!perfCounters_.open()) return false;
+    perfFrameStart_ = perfCounters_.read();
+    return true;
+}
+
+// Called at the top of update(): everything since the previous call is one
+// frame (update, UI, render and swap)
+void Application::samplePerfFrame(double frameSeconds) {
+    PerfSample now = perfCounters_.read();
+    perfZones_.open(perfFrameZone_).add(now - perfFrameStart_);
+    perfFrameStart_ = now;
+
+    perfWindowElapsed_ += frameSeconds;
+    if (perfWindowElapsed_ >= PERF_WINDOW_SECONDS) {
+        perfWindowElapsed_ = 0.0;
+        perfZones_.roll();
+    }
+}
+
 // ============================================================================
 // Command Palette Control
 // ============================================================================
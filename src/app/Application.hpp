@@ -10,11 +10,34 @@
 #include "../ui/DockSpace.hpp"
 #include "../ui/MenuBar.hpp"
 #include "../ui/CommandPalette.hpp"
+#include "../ui/TimingPanel.hpp"
 
 // Settings management
 #include "Settings.hpp"
 
+// Simulation timing
+#include "../core/GameLoop.hpp"
+#include "../core/TimingWheel.hpp"
+#include "../core/LoopMetrics.hpp"
+#include "../core/RenderDecimator.hpp"
+#include "../core/FlightRecorder.hpp"
+#include "../core/TimingStatus.hpp"
+#include "../core/InputQueue.hpp"
+#include "../core/PerfCounters.hpp"
+#include "../core/RenderHandoff.hpp"
+#include "../core/Checkpoint.hpp"
+
+// Simulation state
+#include "../ecs/World.hpp"
+#include "../ecs/CommandBuffer.hpp"
+#include "../ecs/Transform.hpp"
+
+// Monitoring
+#include "../net/MetricsServer.hpp"
+
 // Standard library
+#include <cstdint>
+#include <memory>
 #include <string>
 
 // ============================================================================
@@ -29,12 +52,28 @@ public:
     // Destructor - cleans up resources
     ~Application() = default;  // Default is fine, no manual cleanup needed
     
+    // Called every frame with the real time since the last frame (seconds).
+    // Runs zero or more fixed updates through the GameLoop.
+    void update(double frameSeconds);
+
+    // False while turbo mode is skipping this frame's render (main.cpp then
+    // skips the ImGui frame and the buffer swap entirely)
+    bool shouldRenderFrame() const { return renderThisFrame_; }
+
+    // Turbo disables vsync so the swap doesn't throttle the simulation
+    bool isTurbo() const { return timeController_.isTurbo(); }
+
     // Called every frame to render all UI
     void render();
     
     // Settings persistence
-    void loadSettings(const std::string& path);
+    void loadSettings(const std::string& path);  // readSettings() + applySettings()
     void saveSettings(const std::string& path);
+
+    // Split for startup: reading/parsing the file needs no ImGui context and
+    // can run on a worker thread; applying (theme) must run on the main thread
+    void readSettings(const std::string& path);
+    void applySettings();
     
     // Application control
     bool shouldQuit() const { return shouldQuit_; }
@@ -42,11 +81,81 @@ public:
     
     // Command palette control (called from main.cpp on keyboard shortcut)
     void toggleCommandPalette();
+
+    // Simulation-time timers (cooldowns, timeouts, delayed events)
+    TimingWheel& timers() { return timers_; }
+
+    // Simulation entities. Systems iterate world() during fixedUpdate and
+    // record creates/destroys/component changes in commands(), which are
+    // applied after each tick (see ecs/CommandBuffer.hpp).
+    World& world() { return world_; }
+    CommandBuffer& commands() { return commands_; }
+
+    // Every entity's Transform blended between the last two ticks by the
+    // loop's alpha, refreshed by render(). Row i is transformRows()[i].
+    const TransformStreams& interpolatedTransforms() const { return interpolated_; }
+    const std::vector<Entity>& transformRows() const { return transformPublisher_.rows(); }
+
+    // Simulation checkpoints. Register state blocks with checkpoints();
+    // save/load then cover them plus the loop and time controls (see
+    // core/Checkpoint.hpp). Both log what happened.
+    Checkpointer& checkpoints() { return checkpoints_; }
+    void setCheckpointPath(std::string path) { checkpointPath_ = std::move(path); }
+
+    // Where hitch dumps are written (default: ./flight_recordings)
+    void setFlightRecordingDirectory(std::string directory) { flightRecorder_.setDirectory(std::move(directory)); }
+    bool saveCheckpoint();  // Snapshot now, written in the background
+    // False (state unchanged) if missing or mismatched, or while entities,
+    // queued commands or timers exist: checkpoints don't hold those
+    bool loadCheckpoint();
+
+    // Flight recorder feed (main.cpp times the phases it owns)
+    void recordFramePhase(FramePhase phase, double seconds) { flightRecorder_.recordPhase(phase, seconds); }
+
+    // GLFW key / mouse button callbacks: timestamped now, handed to the
+    // fixed tick whose time window contains them
+    void queueInput(InputDevice device, int code, int action, int mods) {
+        flightRecorder_.recordInput(code, action, mods);
+        inputQueue_.push(device, code, action, mods);
+    }
+
+    // Call right after the buffer swap (input-to-present latency)
+    void markPresented() { inputQueue_.markPresented(); }
+
+    // Render-thread mode: tag the frame being handed off (returns its id),
+    // and report it once the render thread has presented it
+    uint64_t markSubmitted() { return inputQueue_.markSubmitted(); }
+    void framePresented(const PresentedFrame& frame) {
+        inputQueue_.markPresented(frame.id, frame.presentedSeconds);
+        submitToPresent_.add((frame.presentedSeconds - frame.submittedSeconds) * 1000.0);
+    }
+
+    // Latest timing state, safe to load() from any thread (updated per frame)
+    const TimingStatusPublisher& timingStatus() const { return timingStatus_; }
+
+    // Hardware counters per frame / tick / UI zone (optional, off by default).
+    // Call on the thread that runs update() and render(); false if none
+    // could be opened (perfCounters().error() says why).
+    bool enablePerfCounters();
+    const PerfCounters& perfCounters() const { return perfCounters_; }
+
+    // Serve OpenMetrics on 127.0.0.1:port (optional, off by default)
+    bool startMetricsServer(uint16_t port);
+    uint16_t metricsPort() const { return metricsServer_ ? metricsServer_->port() : 0; }
     
 private:
     // Setup commands that can be invoked via command palette
     void registerCommands();
 
+    // One fixed simulation tick
+    void fixedUpdate(double dt);
+
+    // Input delivered to the current tick (see InputQueue.hpp)
+    void handleInput(const InputEvent& event);
+
+    // Closes one frame's hardware counter sample
+    void samplePerfFrame(double frameSeconds);
+
     // Render the settings window
     void renderSettingsWindow();
     
@@ -54,14 +163,65 @@ private:
     DockSpace dockSpace_;
     MenuBar menuBar_;
     CommandPalette commandPalette_;
+    TimingPanel timingPanel_;
     
     // Settings
     SettingsManager settingsManager_;
+
+    // Simulation timing
+    TimeController timeController_;
+    GameLoop gameLoop_{timeController_};  // Declared after timeController_ (holds a reference)
+    FrametimeHistory frametimeHistory_;
+    TimingWheel timers_;
+
+    // Entities, and the changes systems deferred during the current tick
+    World world_;
+    CommandBuffer commands_;
+
+    // Transforms of the last two ticks, and their blend for this frame
+    RenderStateBuffer renderState_;
+    TransformPublisher transformPublisher_;
+    TransformStreams interpolated_;
+
+    // Save/resume of the loop and registered state
+    Checkpointer checkpoints_;
+    std::string checkpointPath_ = "checkpoint.ckpt";
+
+    // Turbo: simulate flat out for one slice per loop iteration, render as
+    // the decimator allows (10 Hz by default, tuned in the timing panel)
+    static constexpr double TURBO_SLICE_SECONDS = 1.0 / 60.0;
+    static constexpr double FRAME_BUDGET_SECONDS = 1.0 / 60.0;  // Checkpoint snapshots past this warn
+    RenderDecimator turboRenderDecimator_;
+    bool renderThisFrame_ = true;
+
+    // Hitch evidence: last ~10 s of frames, dumped to disk on a spike
+    FlightRecorder flightRecorder_;
+    uint32_t ticksThisFrame_ = 0;
+
+    // Timestamped input, delivered per tick
+    InputQueue inputQueue_;
+    LatencyHistogram submitToPresent_;  // Render-thread mode only
+
+    // Hardware counters (idle unless enablePerfCounters() succeeded)
+    static constexpr double PERF_WINDOW_SECONDS = 1.0;
+    PerfCounters perfCounters_;
+    PerfZones perfZones_;
+    size_t perfFrameZone_ = perfZones_.add("frame");
+    size_t perfTickZone_ = perfZones_.add("fixedUpdate");
+    size_t perfUiZone_ = perfZones_.add("ui");
+    PerfSample perfFrameStart_;
+    double perfWindowElapsed_ = 0.0;
+
+    // Monitoring
+    TimingStatusPublisher timingStatus_;
+    LoopMetrics loopMetrics_;
+    std::unique_ptr<MetricsServer> metricsServer_;  // Null unless started
     
     // Application state
     bool shouldQuit_ = false;
     bool showDemoWindow_ = false;    // Toggle ImGui demo window
     bool showSettingsWindow_ = false; // Toggle settings window
+    bool showTimingWindow_ = false;   // Toggle timing panel
 };
 
 #endif // APPLICATION_HPP
\ No newline at end of file
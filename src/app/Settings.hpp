@@ -10,6 +10,8 @@
 #include <string>
 #include <filesystem>  // For creating directories
 
+#include "../core/Logger.hpp"
+
 // ============================================================================
 // Settings Structure
 // Holds all user preferences. Can be converted to/from JSON.
@@ -51,7 +53,7 @@ public:
                 settings_ = j.get<Settings>();      // Convert JSON to Settings struct
             } catch (const nlohmann::json::exception& e) {
                 // JSON parsing failed - keep defaults
-                // Could log error here: fmt::print(stderr, "Settings load error: {}\n", e.what());
+                logWarn("Settings load error ({}): {}", path, e.what());
             }
         }
         // If file doesn't exist or fails to parse, settings_ keeps its defaults
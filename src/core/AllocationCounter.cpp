@@ -0,0 +1,86 @@
+// ============================================================================
+// AllocationCounter.cpp - Replaces Global operator new / operator delete
+// ============================================================================
+//
+// The plain and the std::align_val_t forms are replaced. The standard
+// library defines the array and nothrow variants in terms of those, so
+// every allocation funnels through here. The aligned forms have to be
+// replaced as well: libstdc++ implements them with aligned_alloc directly,
+// not via the plain operator new, so over-aligned allocations (e.g. World
+// chunks) would otherwise go uncounted. The counters are relaxed atomics:
+// we need an exact total, not ordering with respect to other memory.
+//
+
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>  // for std::malloc, std::free, std::aligned_alloc
+#include <new>      // for std::bad_alloc, std::align_val_t
+
+#if defined(_MSC_VER)
+#include <malloc.h>  // for _aligned_malloc, _aligned_free
+#endif
+
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+std::atomic<uint64_t> g_deallocations{0};
+}  // namespace
+
+namespace allocation_counter {
+
+uint64_t allocations() { return g_allocations.load(std::memory_order_relaxed); }
+
+uint64_t deallocations() { return g_deallocations.load(std::memory_order_relaxed); }
+
+}  // namespace allocation_counter
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;  // new must return a unique pointer even for 0 bytes
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    if (p == nullptr) return;
+    g_deallocations.fetch_add(1, std::memory_order_relaxed);
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t size) noexcept {
+    (void)size;
+    ::operator delete(p);
+}
+
+// Over-aligned types (alignas above __STDCPP_DEFAULT_NEW_ALIGNMENT__) and
+// explicit ::operator new(size, std::align_val_t{N}) calls
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    if (align < sizeof(void*)) align = sizeof(void*);
+    // aligned_alloc wants a non-zero multiple of the alignment
+    std::size_t bytes = size == 0 ? align : (size + align - 1) & ~(align - 1);
+#if defined(_MSC_VER)
+    if (void* p = _aligned_malloc(bytes, align)) return p;
+#else
+    if (void* p = std::aligned_alloc(align, bytes)) return p;
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t alignment) noexcept {
+    (void)alignment;
+    if (p == nullptr) return;
+    g_deallocations.fetch_add(1, std::memory_order_relaxed);
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void operator delete(void* p, std::size_t size, std::align_val_t alignment) noexcept {
+    (void)size;
+    ::operator delete(p, alignment);
+}
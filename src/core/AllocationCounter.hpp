@@ -0,0 +1,22 @@
+// AllocationCounter.hpp - Global Heap Allocation Counters
+// ============================================================================
+// PURPOSE: Count every operator new / operator delete in the process so the
+// metrics exporter can show allocation churn. The counting operators live in
+// AllocationCounter.cpp; linking that file into an executable turns them on.
+//
+
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+#include <cstdint>
+
+namespace allocation_counter {
+
+// Total calls to operator new since startup
+uint64_t allocations();
+
+// Total calls to operator delete (with a non-null pointer) since startup
+uint64_t deallocations();
+
+}  // namespace allocation_counter
+
+#endif  // ALLOCATION_COUNTER_HPP
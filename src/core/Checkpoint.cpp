@@ -0,0 +1,312 @@
+// ============================================================================
+// Checkpoint.cpp - Mapping, Snapshot Layout and the Writer Thread
+// ============================================================================
+
+#include "Checkpoint.hpp"
+#include "StateHash.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CHECKPOINT_MMAP 1
+#else
+#include <fstream>
+#endif
+
+using checkpoint_detail::alignUp;
+using checkpoint_detail::BlockEntry;
+using checkpoint_detail::Header;
+
+// ============================================================================
+// CheckpointFile
+// ============================================================================
+
+bool CheckpointFile::open(const std::string& path) {
+    close();
+    error_.clear();
+
+#ifdef CHECKPOINT_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_ = "can't open " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Header))) {
+        ::close(fd);
+        error_ = path + " is too short to be a checkpoint";
+        return false;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    // Private and read-only: pages come straight from the page cache on
+    // first touch, and a save renaming a new file over this one doesn't
+    // affect the mapping (it keeps the old inode alive)
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        error_ = "can't map " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    data_ = static_cast<const std::byte*>(mapping);
+    size_ = size;
+    mapped_ = true;
+#else
+    // No mmap: read the whole file (load time then grows with its size)
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        error_ = "can't open " + path;
+        return false;
+    }
+    std::streamoff size = file.tellg();
+    if (size < static_cast<std::streamoff>(sizeof(Header))) {
+        error_ = path + " is too short to be a checkpoint";
+        return false;
+    }
+    fallback_.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(fallback_.data()), size);
+    if (!file) {
+        fallback_.clear();
+        error_ = "can't read " + path;
+        return false;
+    }
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+#endif
+
+    // Validate the header and the block table (never the block contents)
+    std::memcpy(&header_, data_, sizeof(Header));
+    size_t tableEnd = sizeof(Header) + static_cast<size_t>(header_.blockCount) * sizeof(BlockEntry);
+    if (std::memcmp(header_.magic, checkpoint_detail::MAGIC, sizeof(header_.magic)) != 0) {
+        error_ = path + " is not a checkpoint";
+    } else if (header_.version != checkpoint_detail::VERSION) {
+        error_ = path + " is checkpoint version " + std::to_string(header_.version) + ", expected " +
+                 std::to_string(checkpoint_detail::VERSION);
+    } else if (header_.alignment != checkpoint_detail::ALIGNMENT || header_.fileBytes != size_ ||
+               header_.blockCount > checkpoint_detail::MAX_BLOCKS || tableEnd > size_) {
+        error_ = path + " is truncated or corrupt";
+    }
+    for (size_t i = 0; i < header_.blockCount && error_.empty(); ++i) {
+        BlockEntry block = entry(i);
+        if (block.name[checkpoint_detail::MAX_NAME] != '\0' || block.offset % checkpoint_detail::ALIGNMENT != 0 ||
+            block.offset < tableEnd || block.offset > size_ || block.bytes > size_ - block.offset) {
+            error_ = path + " has a corrupt block table";
+        }
+    }
+    if (!error_.empty()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CheckpointFile::close() {
+#ifdef CHECKPOINT_MMAP
+    if (mapped_) ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    fallback_.clear();
+    header_ = {};
+}
+
+BlockEntry CheckpointFile::entry(size_t index) const {
+    BlockEntry block;
+    std::memcpy(&block, data_ + sizeof(Header) + index * sizeof(BlockEntry), sizeof(BlockEntry));
+    return block;
+}
+
+std::string_view CheckpointFile::blockName(size_t index) const {
+    if (index >= blockCount()) return {};
+    // Straight from the mapping: open() checked the name is NUL-terminated
+    return reinterpret_cast<const char*>(data_ + sizeof(Header) + index * sizeof(BlockEntry));
+}
+
+std::optional<std::span<const std::byte>> CheckpointFile::block(std::string_view name) const {
+    for (size_t i = 0; i < blockCount(); ++i) {
+        if (blockName(i) != name) continue;
+        BlockEntry block = entry(i);
+        return std::span<const std::byte>(data_ + block.offset, static_cast<size_t>(block.bytes));
+    }
+    return std::nullopt;
+}
+
+bool CheckpointFile::verify() const {
+    if (!isOpen()) return false;
+    for (size_t i = 0; i < blockCount(); ++i) {
+        BlockEntry block = entry(i);
+        if (StateHasher::hash(data_ + block.offset, static_cast<size_t>(block.bytes)) != block.hash) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Checkpointer - Registration and Restore
+// ============================================================================
+
+bool Checkpointer::add(CheckpointBlock block) {
+    if (block.name.empty() || block.name.size() > checkpoint_detail::MAX_NAME) return false;
+    if (blocks_.size() >= checkpoint_detail::MAX_BLOCKS) return false;
+    for (const CheckpointBlock& existing : blocks_) {
+        if (existing.name == block.name) return false;
+    }
+    blocks_.push_back(std::move(block));
+    return true;
+}
+
+bool Checkpointer::restore(const CheckpointFile& file) {
+    error_.clear();
+    if (!file.isOpen()) {
+        error_ = "no checkpoint loaded";
+        return false;
+    }
+
+    // Check everything before touching anything
+    std::vector<std::span<const std::byte>> sources;
+    sources.reserve(blocks_.size());
+    for (const CheckpointBlock& block : blocks_) {
+        auto bytes = file.block(block.name);
+        if (!bytes) {
+            error_ = "checkpoint has no block '" + block.name + "'";
+            return false;
+        }
+        if (!block.resizable && bytes->size() != block.size()) {
+            error_ = "block '" + block.name + "' is " + std::to_string(bytes->size()) + " bytes, expected " +
+                     std::to_string(block.size());
+            return false;
+        }
+        sources.push_back(*bytes);
+    }
+
+    for (size_t i = 0; i < blocks_.size(); ++i) blocks_[i].restore(sources[i]);
+    return true;
+}
+
+// ============================================================================
+// Checkpointer - Snapshot (Frame Thread)
+// ============================================================================
+
+bool Checkpointer::save(const std::string& path, const CheckpointLoopState& loop) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_ || writing_) {
+            ++savesDropped_;
+            return false;
+        }
+    }
+    // From here until the handoff below the writer is idle: image_ is ours
+    Timer snapshot;
+
+    // Lay the blocks out first: each starts on its own page
+    size_t tableEnd = sizeof(Header) + blocks_.size() * sizeof(BlockEntry);
+    size_t fileBytes = alignUp(tableEnd);
+    Header header = {};
+    std::memcpy(header.magic, checkpoint_detail::MAGIC, sizeof(header.magic));
+    header.version = checkpoint_detail::VERSION;
+    header.alignment = static_cast<uint32_t>(checkpoint_detail::ALIGNMENT);
+    header.blockCount = static_cast<uint32_t>(blocks_.size());
+    header.loop = loop;
+
+    if (image_.size() < fileBytes) image_.resize(fileBytes);
+    for (size_t i = 0; i < blocks_.size(); ++i) {
+        BlockEntry block = {};
+        std::memcpy(block.name, blocks_[i].name.data(), blocks_[i].name.size());
+        block.offset = fileBytes;
+        block.bytes = blocks_[i].size();
+        std::memcpy(image_.data() + sizeof(Header) + i * sizeof(BlockEntry), &block, sizeof(block));
+        fileBytes = alignUp(fileBytes + static_cast<size_t>(block.bytes));
+    }
+    header.fileBytes = fileBytes;
+    std::memcpy(image_.data(), &header, sizeof(header));
+
+    // Then copy the state into place. Padding is zeroed so the same state
+    // always produces the same file, byte for byte.
+    if (image_.size() < fileBytes) image_.resize(fileBytes);
+    size_t firstBlock = alignUp(tableEnd);
+    std::memset(image_.data() + tableEnd, 0, firstBlock - tableEnd);
+    for (size_t i = 0; i < blocks_.size(); ++i) {
+        BlockEntry block;
+        std::memcpy(&block, image_.data() + sizeof(Header) + i * sizeof(BlockEntry), sizeof(block));
+        size_t begin = static_cast<size_t>(block.offset);
+        size_t end = begin + static_cast<size_t>(block.bytes);
+        blocks_[i].save(std::span<std::byte>(image_.data() + begin, end - begin));
+        std::memset(image_.data() + end, 0, alignUp(end) - end);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ = path;
+        imageBytes_ = fileBytes;
+    }
+    snapshotSeconds_ = snapshot.elapsed();
+    wake_.notify_one();
+    return true;
+}
+
+// ============================================================================
+// Checkpointer - Writer Thread
+// ============================================================================
+
+void Checkpointer::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this]() { return stopping_ || pending_.has_value(); });
+        if (!pending_) return;  // Stopping with nothing left to write
+
+        std::string path = std::move(*pending_);
+        pending_.reset();
+        size_t bytes = imageBytes_;
+        writing_ = true;
+        lock.unlock();
+
+        bool ok = write(path, bytes);
+
+        lock.lock();
+        writing_ = false;
+        if (ok) {
+            ++savesWritten_;
+        } else {
+            ++savesFailed_;
+        }
+        idle_.notify_all();
+    }
+}
+
+bool Checkpointer::write(const std::string& path, size_t bytes) {
+    // Hashing reads every byte, so it happens here rather than in save()
+    Header header;
+    std::memcpy(&header, image_.data(), sizeof(header));
+    for (size_t i = 0; i < header.blockCount; ++i) {
+        std::byte* at = image_.data() + sizeof(Header) + i * sizeof(BlockEntry);
+        BlockEntry block;
+        std::memcpy(&block, at, sizeof(block));
+        block.hash = StateHasher::hash(image_.data() + block.offset, static_cast<size_t>(block.bytes));
+        std::memcpy(at, &block, sizeof(block));
+    }
+
+    std::error_code error;
+    std::filesystem::path target(path);
+    if (target.has_parent_path()) std::filesystem::create_directories(target.parent_path(), error);
+
+    // Write beside the target, then rename over it: a crash mid-write
+    // never leaves a torn checkpoint behind
+    std::string temporary = path + ".tmp";
+    std::FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file) return false;
+    bool ok = std::fwrite(image_.data(), 1, bytes, file) == bytes;
+    ok = std::fclose(file) == 0 && ok;
+    if (ok) std::filesystem::rename(temporary, target, error);
+    if (!ok || error) {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,316 @@
+// Checkpoint.hpp - Memory-Mapped Snapshots of the Loop and Simulation State
+// ============================================================================
+// PURPOSE: Resume a long session where it left off instead of re-simulating
+// hours of ticks to get back to a bug. A checkpoint holds:
+//
+// - The GameLoop: tick, banked accumulator, dropped time, fixed dt
+// - The TimeController: pause, time scale, turbo
+// - Every registered state block: named byte ranges the simulation owns
+//   (POD structs, vectors of POD). RNG streams are registered like any
+//   other block; their 8-byte state is the seed the next tick draws from.
+//
+// FILE LAYOUT (little-endian, every block starts on a 4 KiB boundary):
+//
+//   page 0..:  header | block table (name, offset, size, hash per block)
+//   then:      block 0 bytes, zero padding to the next page, block 1, ...
+//
+// The file IS the in-memory image, byte for byte. CheckpointFile::open()
+// maps it read-only and hands out spans into the mapping; there is no parse
+// step. Opening checks the header and the block table (O(blocks)), never
+// the block contents, so it takes the same time for 1 MB as for 1 GB. Pages
+// are faulted in only when a block is read (restore() or verify()).
+//
+// SAVING: save() runs on the frame thread but only copies the registered
+// blocks into a reused image buffer, already laid out as the file (memcpy
+// speed, no allocation once the buffer has grown). A writer thread then
+// hashes the blocks, writes path.tmp and renames it over path, so a crash
+// mid-write leaves the previous checkpoint intact. One save is in flight at
+// a time; a save requested while the writer is busy is dropped and counted
+// (the same policy as FlightRecorder dumps).
+//
+// The copy still grows with the state (about 6 ms at 16 MiB, 54 ms at
+// 256 MiB here), and that time comes out of the frame that saves.
+// lastSnapshotSeconds() reports it so the caller can see the hitch.
+//
+// Not portable across endianness or across changes to a block's layout:
+// bump the version (or rename the block) when a saved struct changes.
+//
+
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+#include <condition_variable>
+#include <cstddef>  // for size_t, std::byte
+#include <cstdint>  // for uint64_t, uint32_t
+#include <cstring>  // for std::memcpy
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "GameLoop.hpp"
+#include "TimeController.hpp"
+#include "Timer.hpp"
+
+// ============================================================================
+// On-Disk Structures
+// ============================================================================
+
+// Loop and time control state at the moment of the snapshot
+struct CheckpointLoopState {
+    uint64_t tick = 0;
+    double accumulator = 0.0;
+    double droppedTime = 0.0;
+    double fixedDt = 0.0;
+    float timeScale = 1.0f;
+    uint8_t paused = 0;
+    uint8_t turbo = 0;
+    uint8_t reserved[2] = {};
+};
+static_assert(sizeof(CheckpointLoopState) == 40, "stored verbatim: no implicit padding");
+
+namespace checkpoint_detail {
+
+inline constexpr char MAGIC[8] = {'L', 'O', 'O', 'P', 'C', 'K', 'P', 'T'};
+inline constexpr uint32_t VERSION = 1;
+inline constexpr size_t ALIGNMENT = 4096;     // Block alignment (one page on most systems)
+inline constexpr size_t MAX_NAME = 47;        // Block name bytes (NUL-terminated in the table)
+inline constexpr uint32_t MAX_BLOCKS = 4096;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t alignment;
+    uint64_t fileBytes;
+    uint32_t blockCount;
+    uint32_t reserved;
+    CheckpointLoopState loop;
+};
+static_assert(sizeof(Header) == 72, "stored verbatim: no implicit padding");
+
+struct BlockEntry {
+    char name[MAX_NAME + 1];
+    uint64_t offset;  // From the start of the file, a multiple of ALIGNMENT
+    uint64_t bytes;
+    uint64_t hash;    // StateHasher digest of the block (checked by verify())
+};
+static_assert(sizeof(BlockEntry) == 72, "stored verbatim: no implicit padding");
+
+constexpr size_t alignUp(size_t value) { return (value + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+}  // namespace checkpoint_detail
+
+// ============================================================================
+// CheckpointFile - A Loaded Checkpoint (Read-Only Mapping)
+// ============================================================================
+
+class CheckpointFile {
+public:
+    CheckpointFile() = default;
+    ~CheckpointFile() { close(); }
+
+    // Non-copyable (owns a mapping)
+    CheckpointFile(const CheckpointFile&) = delete;
+    CheckpointFile& operator=(const CheckpointFile&) = delete;
+
+    // Maps the file and checks its header and block table. False (see
+    // error()) if it is missing, truncated, or from another version.
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    const std::string& error() const { return error_; }
+
+    const CheckpointLoopState& loop() const { return header_.loop; }
+    size_t blockCount() const { return header_.blockCount; }
+    size_t fileBytes() const { return size_; }
+
+    std::string_view blockName(size_t index) const;
+
+    // The block's bytes inside the mapping (valid until close()), or
+    // nullopt if the checkpoint has no block by that name
+    std::optional<std::span<const std::byte>> block(std::string_view name) const;
+
+    // Hashes every block against the table. Reads the whole file, so it's
+    // a separate step: opening alone stays O(blocks).
+    bool verify() const;
+
+private:
+    checkpoint_detail::BlockEntry entry(size_t index) const;
+
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;                  // False: data_ points into fallback_
+    std::vector<std::byte> fallback_;      // Platforms without mmap read the file instead
+    checkpoint_detail::Header header_ = {};
+    std::string error_;
+};
+
+// ============================================================================
+// Checkpointer - Block Registry and Asynchronous Writer
+// ============================================================================
+
+// One named piece of simulation state. save() fills exactly size() bytes;
+// restore() gets the saved bytes back. Fixed-size blocks are only restored
+// from a block of the same size; resizable ones take any size.
+struct CheckpointBlock {
+    std::string name;
+    std::function<size_t()> size;
+    std::function<void(std::span<std::byte>)> save;
+    std::function<void(std::span<const std::byte>)> restore;
+    bool resizable = false;
+};
+
+class Checkpointer {
+public:
+    Checkpointer() : writer_([this]() { writerLoop(); }) {}
+
+    ~Checkpointer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();  // Finishes a save in progress first
+    }
+
+    // Non-copyable (owns a thread)
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    // ========================================================================
+    // Registration
+    // ========================================================================
+    //
+    // Registered state must outlive the Checkpointer (blocks hold references).
+    // Returns false for an empty, too long (> 47 bytes) or duplicate name.
+    //
+
+    bool add(CheckpointBlock block);
+
+    // A trivially copyable value, saved and restored in place
+    template <typename T>
+    bool addValue(std::string name, T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint raw bytes only for POD state");
+        return add({std::move(name), []() { return sizeof(T); },
+                    [&value](std::span<std::byte> out) { std::memcpy(out.data(), &value, sizeof(T)); },
+                    [&value](std::span<const std::byte> in) { std::memcpy(&value, in.data(), sizeof(T)); },
+                    false});
+    }
+
+    // A vector of trivially copyable values, resized on restore
+    template <typename T>
+    bool addVector(std::string name, std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint raw bytes only for POD state");
+        return add({std::move(name), [&values]() { return values.size() * sizeof(T); },
+                    [&values](std::span<std::byte> out) {
+                        if (!out.empty()) std::memcpy(out.data(), values.data(), out.size());
+                    },
+                    [&values](std::span<const std::byte> in) {
+                        values.resize(in.size() / sizeof(T));
+                        if (!values.empty()) std::memcpy(values.data(), in.data(), values.size() * sizeof(T));
+                    },
+                    true});
+    }
+
+    size_t blockCount() const { return blocks_.size(); }
+
+    // ========================================================================
+    // Save (frame thread) / Restore
+    // ========================================================================
+
+    // Snapshots the loop state and every block, then returns; the writer
+    // thread does the I/O. False if the previous save is still being
+    // written (the request is dropped, see savesDropped()).
+    bool save(const std::string& path, const CheckpointLoopState& loop);
+
+    // Copies every registered block back from a loaded checkpoint. All
+    // blocks are checked first (present, and the right size unless
+    // resizable), so on failure nothing has been touched. Blocks in the
+    // file that nobody registered are ignored.
+    bool restore(const CheckpointFile& file);
+
+    // Why the last restore() failed
+    const std::string& error() const { return error_; }
+
+    // How long the last successful save() held the calling thread
+    double lastSnapshotSeconds() const { return snapshotSeconds_; }
+
+    // Blocks until the writer is idle
+    void waitForWrites() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this]() { return !pending_ && !writing_; });
+    }
+
+    uint32_t savesWritten() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return savesWritten_;
+    }
+    uint32_t savesFailed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return savesFailed_;
+    }
+    uint32_t savesDropped() const { return savesDropped_; }
+
+private:
+    void writerLoop();
+    bool write(const std::string& path, size_t bytes);
+
+    std::vector<CheckpointBlock> blocks_;
+    std::string error_;
+    uint32_t savesDropped_ = 0;  // Frame thread only
+    double snapshotSeconds_ = 0.0;  // Frame thread only
+
+    // The file image. The frame thread fills it; while a save is pending or
+    // being written it belongs to the writer.
+    std::vector<std::byte> image_;
+
+    // Handoff to the writer (guarded by mutex_)
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::optional<std::string> pending_;  // Path of the image waiting to be written
+    size_t imageBytes_ = 0;               // How much of image_ the pending save uses
+    bool writing_ = false;
+    bool stopping_ = false;
+    uint32_t savesWritten_ = 0;
+    uint32_t savesFailed_ = 0;
+
+    std::thread writer_;  // Last: starts after everything above is constructed
+};
+
+// ============================================================================
+// Loop State Helpers
+// ============================================================================
+
+template <typename Clock>
+CheckpointLoopState captureLoopState(const BasicGameLoop<Clock>& loop, const TimeController& time) {
+    CheckpointLoopState state;
+    state.tick = loop.tick();
+    state.accumulator = loop.accumulator();
+    state.droppedTime = loop.droppedTime();
+    state.fixedDt = loop.fixedDt();
+    state.timeScale = time.getTimeScale();
+    state.paused = time.isPaused() ? 1 : 0;
+    state.turbo = time.isTurbo() ? 1 : 0;
+    return state;
+}
+
+// False (and nothing changed) if the checkpoint was taken with another
+// fixed timestep: its ticks would mean a different amount of time
+template <typename Clock>
+bool restoreLoopState(const CheckpointLoopState& state, BasicGameLoop<Clock>& loop, TimeController& time) {
+    if (state.fixedDt != loop.fixedDt()) return false;
+    loop.restore(state.tick, state.accumulator, state.droppedTime);
+    time.reset();
+    time.setTimeScale(state.timeScale);
+    if (state.paused) time.pause();
+    time.setTurbo(state.turbo != 0);
+    return true;
+}
+
+#endif  // CHECKPOINT_HPP
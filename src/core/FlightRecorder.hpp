@@ -0,0 +1,470 @@
+// FlightRecorder.hpp - Always-On Ring of Recent Frames, Dumped on Hitches
+// ============================================================================
+// PURPOSE: When a frame spikes, keep the evidence. The recorder holds the
+// last few seconds of:
+//
+// - Frame timings with a phase breakdown (events / update / UI / render)
+// - Profiler zones (named durations, e.g. each fixed update)
+// - Input events (key / mouse button presses)
+//
+// in fixed-size rings (no allocation while recording). endFrame() compares
+// the frame against the rolling median from FrametimeHistory; when it is
+// more than `hitchMultiple` times slower, the rings are frozen into a copy
+// and a background thread writes that copy to disk. The frame loop never
+// touches the file system.
+//
+// RATE LIMITING: after a dump, further hitches are ignored for
+// `cooldownSeconds`, at most `maxDumps` files are written per session, and
+// if the writer is still busy with the previous dump the new one is dropped
+// (counted in droppedDumps()). A hitch storm produces one file, not hundreds.
+//
+// FRAME BOUNDARIES: phases, zones and inputs recorded between two
+// endFrame() calls belong to the frame that endFrame() closes.
+//
+// FILES: <directory>/hitch_<session>_<frame>.flr, where the session is the
+// local time the recorder started (20261018-142530-123). Frame numbers
+// restart every run; the session keeps one run from overwriting another's.
+//
+
+#ifndef FLIGHT_RECORDER_HPP
+#define FLIGHT_RECORDER_HPP
+#include <algorithm>  // for std::max
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t, uint32_t, int32_t
+#include <cstdio>   // for std::snprintf
+#include <ctime>    // for std::strftime
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>  // for std::move
+#include <vector>
+
+// Where a frame's time went (seconds are recorded, stored as milliseconds)
+enum class FramePhase : uint8_t { Events, Update, Ui, Render, COUNT };
+
+inline constexpr std::array<const char*, static_cast<size_t>(FramePhase::COUNT)> FRAME_PHASE_NAMES =
+    {"events", "update", "ui", "render"};
+
+struct FlightFrame {
+    uint64_t frame = 0;
+    double time = 0.0;  // Seconds since the recorder started (sum of frame times)
+    float frameMs = 0.0f;
+    std::array<float, static_cast<size_t>(FramePhase::COUNT)> phaseMs = {};
+    uint32_t ticks = 0;  // Fixed updates run during this frame
+};
+
+struct FlightZone {
+    uint64_t frame = 0;
+    const char* name = "";  // Must be a string literal (stored by pointer)
+    float durationMs = 0.0f;
+};
+
+struct FlightInput {
+    uint64_t frame = 0;
+    int32_t key = 0;     // GLFW key or mouse button code
+    int32_t action = 0;  // GLFW_PRESS / GLFW_RELEASE / GLFW_REPEAT
+    int32_t mods = 0;
+};
+
+// A frozen copy of the rings, oldest entries first
+struct FlightDump {
+    uint64_t hitchFrame = 0;
+    float hitchMs = 0.0f;
+    float medianMs = 0.0f;
+    std::vector<FlightFrame> frames;
+    std::vector<std::string> zoneNames;  // Zone name table (zones index into it)
+    std::vector<std::pair<FlightZone, uint32_t>> zones;  // Zone + index into zoneNames
+    std::vector<FlightInput> inputs;
+};
+
+struct FlightRecorderConfig {
+    size_t frames = 600;           // ~10 s at 60 FPS
+    size_t zones = 4096;
+    size_t inputs = 512;
+    float hitchMultiple = 3.0f;    // Trigger above this multiple of the median
+    float minHitchMs = 8.0f;       // Ignore "hitches" shorter than this
+    size_t warmupFrames = 120;     // No trigger until the median means something
+    double cooldownSeconds = 10.0;
+    uint32_t maxDumps = 20;
+    std::string directory = "flight_recordings";  // Relative to the working directory
+};
+
+// ============================================================================
+// Fixed Ring (overwrites the oldest entry when full)
+// ============================================================================
+
+template <typename T>
+class FlightRing {
+public:
+    explicit FlightRing(size_t capacity) : items_(std::max<size_t>(capacity, 1)) {}
+
+    void push(const T& item) {
+        items_[writeIndex_] = item;
+        writeIndex_ = (writeIndex_ + 1) % items_.size();
+        if (count_ < items_.size()) ++count_;
+    }
+
+    size_t size() const { return count_; }
+
+    // Oldest first
+    std::vector<T> copy() const {
+        std::vector<T> out;
+        out.reserve(count_);
+        size_t oldest = (writeIndex_ + items_.size() - count_) % items_.size();
+        for (size_t i = 0; i < count_; ++i) out.push_back(items_[(oldest + i) % items_.size()]);
+        return out;
+    }
+
+private:
+    std::vector<T> items_;
+    size_t writeIndex_ = 0;
+    size_t count_ = 0;
+};
+
+// ============================================================================
+// FlightRecorder
+// ============================================================================
+
+class FlightRecorder {
+public:
+    explicit FlightRecorder(FlightRecorderConfig config = {})
+        : config_(std::move(config)),
+          frames_(config_.frames),
+          zones_(config_.zones),
+          inputs_(config_.inputs),
+          session_(sessionStamp()),
+          writer_([this]() { writerLoop(); }) {}
+
+    ~FlightRecorder() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();  // Finishes a dump in progress first
+    }
+
+    // Non-copyable (owns a thread)
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    // ========================================================================
+    // Recording (frame thread only)
+    // ========================================================================
+
+    void recordPhase(FramePhase phase, double seconds) {
+        current_.phaseMs[static_cast<size_t>(phase)] += static_cast<float>(seconds * 1000.0);
+    }
+
+    void recordZone(const char* name, double seconds) {
+        zones_.push({frame_, name, static_cast<float>(seconds * 1000.0)});
+    }
+
+    void recordInput(int32_t key, int32_t action, int32_t mods) {
+        inputs_.push({frame_, key, action, mods});
+    }
+
+    // Close the current frame. medianMs is FrametimeHistory::median() from
+    // BEFORE this frame was pushed. Returns true if a dump was queued.
+    bool endFrame(double frameSeconds, uint32_t ticks, float medianMs) {
+        current_.frame = frame_;
+        current_.time = time_;
+        current_.frameMs = static_cast<float>(frameSeconds * 1000.0);
+        current_.ticks = ticks;
+        frames_.push(current_);
+
+        bool queued = false;
+        if (isHitch(current_.frameMs, medianMs)) queued = trigger(current_.frameMs, medianMs);
+
+        time_ += frameSeconds;
+        ++frame_;
+        current_ = FlightFrame{};
+        return queued;
+    }
+
+    // ========================================================================
+    // Status
+    // ========================================================================
+
+    const FlightRecorderConfig& config() const { return config_; }
+    void setHitchMultiple(float multiple) { config_.hitchMultiple = std::max(1.0f, multiple); }
+
+    // Where later dumps go (created on the first dump)
+    void setDirectory(std::string directory) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        config_.directory = std::move(directory);
+    }
+
+    // Part of every file name this recorder writes
+    const std::string& session() const { return session_; }
+
+    uint64_t frame() const { return frame_; }
+    uint32_t dumpsQueued() const { return dumpsQueued_; }
+    uint32_t droppedDumps() const { return droppedDumps_; }
+
+    // Blocks until the writer is idle; returns the files written so far
+    std::vector<std::string> waitForWrites() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this]() { return !pending_ && !writing_; });
+        return written_;
+    }
+
+    // ========================================================================
+    // File Format
+    // ========================================================================
+    //
+    // Binary layout (little-endian):
+    //   "FLRC" | version u32 | hitch frame u64 | hitch ms f32 | median ms f32
+    //   phase count u32 | zone name count u32 | per name: length u32 | bytes
+    //   frame count u32 | per frame: frame u64 | time f64 | frame ms f32 |
+    //                                phase ms f32 x phase count | ticks u32
+    //   zone count u32  | per zone:  frame u64 | name index u32 | ms f32
+    //   input count u32 | per input: frame u64 | key i32 | action i32 | mods i32
+    //
+
+    static bool save(const FlightDump& dump, const std::string& path) {
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        file.write(MAGIC, 4);
+        writePod(file, VERSION);
+        writePod(file, dump.hitchFrame);
+        writePod(file, dump.hitchMs);
+        writePod(file, dump.medianMs);
+        writePod(file, static_cast<uint32_t>(FramePhase::COUNT));
+
+        writePod(file, static_cast<uint32_t>(dump.zoneNames.size()));
+        for (const std::string& name : dump.zoneNames) {
+            writePod(file, static_cast<uint32_t>(name.size()));
+            file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+
+        writePod(file, static_cast<uint32_t>(dump.frames.size()));
+        for (const FlightFrame& f : dump.frames) {
+            writePod(file, f.frame);
+            writePod(file, f.time);
+            writePod(file, f.frameMs);
+            for (float ms : f.phaseMs) writePod(file, ms);
+            writePod(file, f.ticks);
+        }
+
+        writePod(file, static_cast<uint32_t>(dump.zones.size()));
+        for (const auto& [zone, nameIndex] : dump.zones) {
+            writePod(file, zone.frame);
+            writePod(file, nameIndex);
+            writePod(file, zone.durationMs);
+        }
+
+        writePod(file, static_cast<uint32_t>(dump.inputs.size()));
+        for (const FlightInput& input : dump.inputs) {
+            writePod(file, input.frame);
+            writePod(file, input.key);
+            writePod(file, input.action);
+            writePod(file, input.mods);
+        }
+        return file.good();
+    }
+
+    // Returns nullopt if the file is missing, truncated or from another
+    // version. Loaded zones have name = "" — use the index into zoneNames.
+    static std::optional<FlightDump> load(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return std::nullopt;
+
+        char magic[4] = {};
+        uint32_t version = 0;
+        uint32_t phases = 0;
+        FlightDump dump;
+        file.read(magic, 4);
+        readPod(file, version);
+        readPod(file, dump.hitchFrame);
+        readPod(file, dump.hitchMs);
+        readPod(file, dump.medianMs);
+        readPod(file, phases);
+        if (!file || std::string(magic, 4) != std::string(MAGIC, 4) || version != VERSION ||
+            phases != static_cast<uint32_t>(FramePhase::COUNT)) {
+            return std::nullopt;
+        }
+
+        uint32_t count = 0;
+        readPod(file, count);
+        if (!file || count > MAX_ENTRIES) return std::nullopt;
+        dump.zoneNames.resize(count);
+        for (std::string& name : dump.zoneNames) {
+            uint32_t length = 0;
+            readPod(file, length);
+            if (!file || length > 4096) return std::nullopt;
+            name.resize(length);
+            file.read(name.data(), length);
+        }
+
+        readPod(file, count);
+        if (!file || count > MAX_ENTRIES) return std::nullopt;
+        dump.frames.resize(count);
+        for (FlightFrame& f : dump.frames) {
+            readPod(file, f.frame);
+            readPod(file, f.time);
+            readPod(file, f.frameMs);
+            for (float& ms : f.phaseMs) readPod(file, ms);
+            readPod(file, f.ticks);
+        }
+
+        readPod(file, count);
+        if (!file || count > MAX_ENTRIES) return std::nullopt;
+        dump.zones.resize(count);
+        for (auto& [zone, nameIndex] : dump.zones) {
+            readPod(file, zone.frame);
+            readPod(file, nameIndex);
+            readPod(file, zone.durationMs);
+            if (nameIndex >= dump.zoneNames.size()) return std::nullopt;
+        }
+
+        readPod(file, count);
+        if (!file || count > MAX_ENTRIES) return std::nullopt;
+        dump.inputs.resize(count);
+        for (FlightInput& input : dump.inputs) {
+            readPod(file, input.frame);
+            readPod(file, input.key);
+            readPod(file, input.action);
+            readPod(file, input.mods);
+        }
+        if (!file) return std::nullopt;
+        return dump;
+    }
+
+private:
+    static constexpr char MAGIC[4] = {'F', 'L', 'R', 'C'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t MAX_ENTRIES = 1u << 24;
+
+    bool isHitch(float frameMs, float medianMs) const {
+        if (frame_ < config_.warmupFrames || medianMs <= 0.0f) return false;
+        return frameMs >= config_.minHitchMs && frameMs > medianMs * config_.hitchMultiple;
+    }
+
+    bool trigger(float hitchMs, float medianMs) {
+        if (dumpsQueued_ >= config_.maxDumps) return false;
+        if (lastDumpTime_ && time_ - *lastDumpTime_ < config_.cooldownSeconds) return false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_ || writing_) {
+                ++droppedDumps_;
+                return false;
+            }
+            pending_ = freeze(hitchMs, medianMs);
+        }
+        wake_.notify_one();
+        lastDumpTime_ = time_;
+        ++dumpsQueued_;
+        return true;
+    }
+
+    // Copy the rings (the only allocation, and only on a hitch)
+    FlightDump freeze(float hitchMs, float medianMs) const {
+        FlightDump dump;
+        dump.hitchFrame = frame_;
+        dump.hitchMs = hitchMs;
+        dump.medianMs = medianMs;
+        dump.frames = frames_.copy();
+        dump.inputs = inputs_.copy();
+
+        // Zone names are literals: intern by pointer into a small table
+        std::vector<const char*> seen;
+        for (const FlightZone& zone : zones_.copy()) {
+            uint32_t index = 0;
+            while (index < seen.size() && seen[index] != zone.name) ++index;
+            if (index == seen.size()) {
+                seen.push_back(zone.name);
+                dump.zoneNames.emplace_back(zone.name);
+            }
+            dump.zones.emplace_back(zone, index);
+        }
+        return dump;
+    }
+
+    void writerLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [this]() { return stopping_ || pending_.has_value(); });
+            if (!pending_) return;  // Stopping with nothing left to write
+
+            FlightDump dump = std::move(*pending_);
+            pending_.reset();
+            std::filesystem::path directory = config_.directory;
+            writing_ = true;
+            lock.unlock();
+
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+            std::string path =
+                (directory / ("hitch_" + session_ + "_" + std::to_string(dump.hitchFrame) + ".flr")).string();
+            bool ok = save(dump, path);
+
+            lock.lock();
+            writing_ = false;
+            if (ok) written_.push_back(path);
+            idle_.notify_all();
+        }
+    }
+
+    // Local start time, to the millisecond
+    static std::string sessionStamp() {
+        auto now = std::chrono::system_clock::now();
+        std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+        std::tm local{};
+#if defined(_WIN32)
+        localtime_s(&local, &seconds);
+#else
+        localtime_r(&seconds, &local);
+#endif
+        char date[32] = "";
+        std::strftime(date, sizeof(date), "%Y%m%d-%H%M%S", &local);
+        auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+        char stamp[48] = "";
+        std::snprintf(stamp, sizeof(stamp), "%s-%03d", date, static_cast<int>(millis));
+        return stamp;
+    }
+
+    template <typename T>
+    static void writePod(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static void readPod(std::ifstream& file, T& value) {
+        file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    FlightRecorderConfig config_;
+
+    // Rings and the open frame (frame thread only)
+    FlightRing<FlightFrame> frames_;
+    FlightRing<FlightZone> zones_;
+    FlightRing<FlightInput> inputs_;
+    FlightFrame current_;
+    uint64_t frame_ = 0;
+    double time_ = 0.0;
+    std::optional<double> lastDumpTime_;
+    uint32_t dumpsQueued_ = 0;
+    uint32_t droppedDumps_ = 0;
+    std::string session_;
+
+    // Handoff to the writer (guarded by mutex_, as is config_.directory)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::optional<FlightDump> pending_;
+    bool writing_ = false;
+    bool stopping_ = false;
+    std::vector<std::string> written_;
+
+    std::thread writer_;  // Last: starts after everything above is constructed
+};
+#endif  // FLIGHT_RECORDER_HPP
@@ -1,11 +1,16 @@
 // FrametimeHistory.hpp - Circular Buffer for Frametime Samples
 // PURPOSE: Store recent frametime samples for ImGui graphs.
 // Uses a fixed-size array that wraps around (circular buffer).
+// Behind the raw ring, FrametimeLevels keeps 1 s / 1 min / 10 min summaries
+// so long sessions (up to 24 h) can be graphed too.
 
 #ifndef FRAMETIME_HISTORY_HPP
 #define FRAMETIME_HISTORY_HPP
+#include <algorithm>  // for std::nth_element
 #include <array>
 #include <cstddef>  // for size_t
+
+#include "FrametimeLevels.hpp"
 class FrametimeHistory {
 public:
     // Constants
@@ -22,6 +27,7 @@ public:
             ++count_;
             // Track how many samples we have (until buffer is full)
          }
+        levels_.push(frametime_ms);
 
          
 
@@ -38,6 +44,23 @@ public:
     // Current write position (useful for ImGui offset parameter)
     size_t offset() const { return writeIndex_; }
 
+    // How many of the newest samples add up to `window_ms` (at most SIZE)
+    size_t samplesWithin(float window_ms) const {
+        float total = 0.0f;
+        size_t n = 0;
+        while (n < count_ && total < window_ms) {
+            total += samples_[(writeIndex_ + SIZE - 1 - n) % SIZE];
+            ++n;
+        }
+        return n;
+    }
+
+    // Oldest-first view of the newest n samples: recent(n, n - 1) is the latest
+    float recent(size_t n, size_t i) const { return samples_[(writeIndex_ + SIZE - n + i) % SIZE]; }
+
+    // Long-term 1 s / 1 min / 10 min buckets
+    const FrametimeLevels& levels() const { return levels_; }
+
 
 
 
@@ -71,14 +94,27 @@ public:
             return max;
         }
         
+        // Rolling median of the stored samples (robust against the very
+        // spikes a hitch detector is looking for, unlike average())
+        float median() const {
+            if (count_ == 0) return 0.0f;
+
+            std::array<float, SIZE> sorted = samples_;
+            auto middle = sorted.begin() + static_cast<std::ptrdiff_t>(count_ / 2);
+            std::nth_element(sorted.begin(), middle, sorted.begin() + static_cast<std::ptrdiff_t>(count_));
+            return *middle;
+        }
+
         void clear() {
             samples_.fill(0.0f);
             writeIndex_ = 0;
             count_ = 0;
+            levels_.clear();
         }
     private:
         std::array<float, SIZE> samples_ = {};  // Zero-initialized
         size_t writeIndex_ = 0;                  // Where next sample goes
         size_t count_ = 0;                       // Samples written (caps at SIZE)
+        FrametimeLevels levels_;                 // Long-term summaries
 };
 #endif // FRAMETIME_HISTORY_HPP
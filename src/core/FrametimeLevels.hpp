@@ -0,0 +1,168 @@
+// FrametimeLevels.hpp - Long-Term Frametime Pyramid (1 s / 1 min / 10 min)
+// PURPOSE: FrametimeHistory's raw ring only covers ~2 seconds. For soak
+// sessions we also keep coarser levels of detail, each a fixed ring of
+// buckets holding min / avg / max / p99:
+//
+//   Level 0:  1 s buckets x 300  = last 5 minutes
+//   Level 1:  1 min buckets x 120 = last 2 hours
+//   Level 2: 10 min buckets x 144 = last 24 hours
+//
+// HOW IT STAYS O(1) PER PUSH:
+// Every push updates one open "accumulator" per level (min, max, sum, and a
+// log-scale histogram bin for the percentile) — three constant-time updates.
+// Time comes from the frame times themselves (they add up to wall time), so
+// no clock is needed. When level 0 has collected a second it closes a
+// bucket; every 60 level-0 buckets close a level-1 bucket, and so on. The
+// only loop is over the fixed histogram when a bucket closes (once a second).
+//
+// Memory is fixed: ~16 KB of buckets and histograms, whatever the
+// session length. A single frame longer than a bucket (a stall, a debugger
+// break) closes one bucket with a large max rather than a run of empty ones.
+
+#ifndef FRAMETIME_LEVELS_HPP
+#define FRAMETIME_LEVELS_HPP
+#include <algorithm>  // for std::min, std::max
+#include <array>
+#include <cmath>      // for std::log2, std::exp2
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+
+// One closed bucket (all values in milliseconds)
+struct FrametimeBucket {
+    float minimum = 0.0f;
+    float average = 0.0f;
+    float maximum = 0.0f;
+    float p99 = 0.0f;  // Histogram estimate: within ~9% of the true value
+};
+
+class FrametimeLevels {
+public:
+    static constexpr size_t LEVELS = 3;
+    static constexpr std::array<double, LEVELS> BUCKET_SECONDS = {1.0, 60.0, 600.0};
+    static constexpr std::array<size_t, LEVELS> CAPACITY = {300, 120, 144};
+
+    // Child buckets per parent bucket (1 s -> 1 min -> 10 min)
+    static constexpr std::array<size_t, LEVELS> CHILDREN = {0, 60, 10};
+
+    void push(float frametime_ms) {
+        for (Accumulator& acc : open_) acc.add(frametime_ms);
+
+        elapsedMs_ += static_cast<double>(frametime_ms);
+        double bucketMs = BUCKET_SECONDS[0] * 1000.0;
+        if (elapsedMs_ < bucketMs) return;
+
+        // Carry the overshoot so buckets stay aligned to real time, but don't
+        // replay a long stall as a run of empty buckets
+        elapsedMs_ -= bucketMs;
+        if (elapsedMs_ >= bucketMs) elapsedMs_ = 0.0;
+
+        close(0);
+        for (size_t level = 1; level < LEVELS; ++level) {
+            if (++closedChildren_[level] < CHILDREN[level]) break;
+            closedChildren_[level] = 0;
+            close(level);
+        }
+    }
+
+    // ========================================================================
+    // Getters
+    // ========================================================================
+
+    // Closed buckets stored at this level (caps at CAPACITY[level])
+    size_t count(size_t level) const { return rings_[level].count; }
+
+    // i = 0 is the oldest stored bucket, count(level) - 1 the newest
+    const FrametimeBucket& bucket(size_t level, size_t i) const {
+        const Ring& ring = rings_[level];
+        size_t capacity = CAPACITY[level];
+        size_t oldest = (ring.writeIndex + capacity - ring.count) % capacity;
+        return ring.buckets[(oldest + i) % capacity];
+    }
+
+    void clear() {
+        for (Ring& ring : rings_) {
+            ring.writeIndex = 0;
+            ring.count = 0;
+        }
+        for (Accumulator& acc : open_) acc.reset();
+        closedChildren_.fill(0);
+        elapsedMs_ = 0.0;
+    }
+
+private:
+    static constexpr size_t MAX_CAPACITY = *std::max_element(CAPACITY.begin(), CAPACITY.end());
+
+    // Log-scale histogram: 8 bins per octave from 0.05 ms to ~13 s
+    static constexpr float HISTOGRAM_MIN_MS = 0.05f;
+    static constexpr int BINS_PER_OCTAVE = 8;
+    static constexpr size_t BINS = 18 * BINS_PER_OCTAVE + 1;
+
+    static size_t binFor(float ms) {
+        if (!(ms > HISTOGRAM_MIN_MS)) return 0;  // Also catches NaN
+        float bin = std::log2(ms / HISTOGRAM_MIN_MS) * static_cast<float>(BINS_PER_OCTAVE);
+        return std::min(BINS - 1, static_cast<size_t>(bin) + 1);
+    }
+
+    // Upper edge of a bin in milliseconds
+    static float binLimit(size_t bin) {
+        return HISTOGRAM_MIN_MS *
+               std::exp2(static_cast<float>(bin) / static_cast<float>(BINS_PER_OCTAVE));
+    }
+
+    struct Accumulator {
+        float minimum = 0.0f;
+        float maximum = 0.0f;
+        double sum = 0.0;
+        uint32_t count = 0;
+        std::array<uint32_t, BINS> histogram = {};
+
+        void add(float ms) {
+            minimum = count == 0 ? ms : std::min(minimum, ms);
+            maximum = count == 0 ? ms : std::max(maximum, ms);
+            sum += static_cast<double>(ms);
+            ++count;
+            ++histogram[binFor(ms)];
+        }
+
+        FrametimeBucket finish() const {
+            FrametimeBucket bucket;
+            if (count == 0) return bucket;
+            bucket.minimum = minimum;
+            bucket.maximum = maximum;
+            bucket.average = static_cast<float>(sum / count);
+
+            // Walk down from the slowest bin until more than 1% is covered
+            uint32_t tail = count / 100;
+            uint32_t seen = 0;
+            size_t bin = BINS - 1;
+            for (; bin > 0; --bin) {
+                seen += histogram[bin];
+                if (seen > tail) break;
+            }
+            bucket.p99 = std::clamp(binLimit(bin), minimum, maximum);
+            return bucket;
+        }
+
+        void reset() { *this = Accumulator{}; }
+    };
+
+    struct Ring {
+        std::array<FrametimeBucket, MAX_CAPACITY> buckets = {};
+        size_t writeIndex = 0;
+        size_t count = 0;
+    };
+
+    void close(size_t level) {
+        Ring& ring = rings_[level];
+        ring.buckets[ring.writeIndex] = open_[level].finish();
+        ring.writeIndex = (ring.writeIndex + 1) % CAPACITY[level];
+        if (ring.count < CAPACITY[level]) ++ring.count;
+        open_[level].reset();
+    }
+
+    std::array<Ring, LEVELS> rings_ = {};
+    std::array<Accumulator, LEVELS> open_ = {};
+    std::array<size_t, LEVELS> closedChildren_ = {};
+    double elapsedMs_ = 0.0;  // Time collected in level 0's open bucket
+};
+#endif  // FRAMETIME_LEVELS_HPP
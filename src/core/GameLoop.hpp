@@ -6,6 +6,8 @@
 // - Spiral of death protection
 // - Interpolation alpha for smooth rendering
 // - Integration with TimeController for pause/step
+// The clock (only used to time turbo slices) is a policy parameter; GameLoop
+// is the real-clock version, BasicGameLoop<VirtualClock> is for tests.
 
 #ifndef GAME_LOOP
 #define GAME_LOOP
@@ -14,16 +16,180 @@
 #include "FrameTimeHistory.hpp"
 
 #include <algorithm>
+#include <cstdint>  // for uint64_t
 
-class GameLoop {
+template <typename Clock = Timer::Clock>
+class BasicGameLoop {
 
 public:
+    // 60 simulation ticks per second, independent of the render rate
+    static constexpr double DEFAULT_FIXED_DT = 1.0 / 60.0;
 
+    // Spiral of death cap: never bank more than 250 ms of real time per frame.
+    // Without this, one slow frame makes the next frame run MORE updates,
+    // which makes it slower still, until the app locks up.
+    static constexpr double MAX_FRAME_TIME = 0.25;
 
+    explicit BasicGameLoop(TimeController& time, double fixedDt = DEFAULT_FIXED_DT)
+        : time_(time), fixedDt_(fixedDt) {}
+
+    // ========================================================================
+    // Advance - Called Once Per Rendered Frame
+    // ========================================================================
+    //
+    // HOW IT WORKS:
+    // 1. Clamp the frame time (spiral of death protection)
+    // 2. Scale it by the TimeController's time scale and bank it
+    // 3. Run update(fixedDt) while a full timestep is banked
+    // 4. The remainder becomes the interpolation alpha for rendering
+    //
+    // While paused nothing is banked; a pending step() runs exactly one update.
+    // Returns the number of fixed updates that ran this frame.
+    //
+
+    template <typename UpdateFn>
+    int advance(double frameSeconds, UpdateFn&& update) {
+        double wallSeconds = frameSeconds;
+
+        // The first normal frame after turbo would otherwise bank the last
+        // turbo slice (plus its render) and replay it as a burst of catch-up
+        // ticks. Start pacing again from zero instead.
+        if (leavingTurbo_) {
+            leavingTurbo_ = false;
+            frameSeconds = 0.0;
+        }
+
+        if (frameSeconds > MAX_FRAME_TIME) {
+            droppedTime_ += frameSeconds - MAX_FRAME_TIME;
+            frameSeconds = MAX_FRAME_TIME;
+        }
+
+        if (time_.isPaused()) {
+            int ticks = runStep(update);
+            measureSpeed(wallSeconds, ticks);
+            return ticks;
+        }
+
+        accumulator_ += frameSeconds * static_cast<double>(time_.getTimeScale());
+
+        int ticks = 0;
+        while (accumulator_ >= fixedDt_) {
+            update(fixedDt_);
+            ++tick_;
+            accumulator_ -= fixedDt_;
+            ++ticks;
+        }
+        measureSpeed(wallSeconds, ticks);
+        return ticks;
+    }
+
+    // ========================================================================
+    // Turbo Advance - Called Instead of advance() While Turbo Is On
+    // ========================================================================
+    //
+    // Runs fixed updates back-to-back until `sliceSeconds` of wall time have
+    // been spent, then returns so the caller can poll input (and maybe
+    // render). Nothing is banked and nothing is dropped: turbo simply isn't
+    // paced by real time. frameSeconds (the whole previous loop iteration,
+    // render included) only feeds the speed readout.
+    //
+
+    template <typename UpdateFn>
+    int advanceTurbo(double frameSeconds, double sliceSeconds, UpdateFn&& update) {
+        accumulator_ = 0.0;  // alpha = 0: render exactly the latest tick
+        leavingTurbo_ = true;
+
+        if (time_.isPaused()) {
+            int ticks = runStep(update);
+            measureSpeed(frameSeconds, ticks);
+            return ticks;
+        }
+
+        BasicTimer<Clock> slice;
+        int ticks = 0;
+        do {
+            update(fixedDt_);
+            ++tick_;
+            ++ticks;
+        } while (slice.elapsed() < sliceSeconds);
+
+        measureSpeed(frameSeconds, ticks);
+        return ticks;
+    }
+
+    // ========================================================================
+    // Getters
+    // ========================================================================
+
+    // 0.0 = render the previous state, 1.0 = render the current state
+    double alpha() const { return accumulator_ / fixedDt_; }
+
+    // Number of fixed updates run so far (the simulation clock)
+    uint64_t tick() const { return tick_; }
+
+    double fixedDt() const { return fixedDt_; }
+    double accumulator() const { return accumulator_; }
+
+    // Real time thrown away by the spiral of death cap (seconds)
+    double droppedTime() const { return droppedTime_; }
+
+    // Effective speed: simulated seconds per wall-clock second, averaged over
+    // the last ~0.5 s (1.0 = real time, 0.5 = slow-motion, 40 = turbo at 40x)
+    double speedMultiplier() const { return speedMultiplier_; }
+
+    void reset() {
+        accumulator_ = 0.0;
+        droppedTime_ = 0.0;
+        tick_ = 0;
+        leavingTurbo_ = false;
+        speedWallSeconds_ = 0.0;
+        speedSimSeconds_ = 0.0;
+        speedMultiplier_ = 1.0;
+    }
+
+    // Resume from a checkpoint (see Checkpoint.hpp): the simulation clock
+    // and banked time carry over, the speed readout starts fresh
+    void restore(uint64_t tick, double accumulator, double droppedTime) {
+        reset();
+        tick_ = tick;
+        accumulator_ = accumulator;
+        droppedTime_ = droppedTime;
+    }
 
 private:
+    static constexpr double SPEED_WINDOW = 0.5;  // Seconds of wall time per readout
+
+    // While paused, a pending step() runs exactly one update
+    template <typename UpdateFn>
+    int runStep(UpdateFn&& update) {
+        if (!time_.consumeStep()) return 0;
+        update(fixedDt_);
+        ++tick_;
+        return 1;
+    }
+
+    void measureSpeed(double wallSeconds, int ticks) {
+        speedWallSeconds_ += wallSeconds;
+        speedSimSeconds_ += ticks * fixedDt_;
+        if (speedWallSeconds_ >= SPEED_WINDOW) {
+            speedMultiplier_ = speedSimSeconds_ / speedWallSeconds_;
+            speedWallSeconds_ = 0.0;
+            speedSimSeconds_ = 0.0;
+        }
+    }
+
+    TimeController& time_;
+    double fixedDt_;
+    double accumulator_ = 0.0;  // Banked, not yet simulated time (seconds)
+    double droppedTime_ = 0.0;
+    uint64_t tick_ = 0;
+    bool leavingTurbo_ = false;
 
-}
+    double speedWallSeconds_ = 0.0;
+    double speedSimSeconds_ = 0.0;
+    double speedMultiplier_ = 1.0;
+};
 
+using GameLoop = BasicGameLoop<>;
 
 #endif // GAME_LOOP
@@ -0,0 +1,193 @@
+// HashLog.hpp - Per-Tick State Hash Log and Desync Detection
+// ============================================================================
+// PURPOSE: Record one row of state hashes per fixed tick so two runs of the
+// same simulation can be compared. Each row holds:
+//
+//   [ tick | combined hash | subsystem 0 hash | subsystem 1 hash | ... ]
+//
+// Rows live back-to-back in one flat vector (8 bytes per value, no per-row
+// allocation). The combined hash lets the comparison skip equal rows with a
+// single compare; subsystem hashes tell you WHERE two runs diverged.
+//
+// Logs can be written to disk and loaded back, so a run from one build can
+// be compared against a run from another build (different flags, compilers).
+// The file also carries a config string (whatever settings the recorder
+// says must match, e.g. "particles=10000 seed=1"). A reference from another
+// setup is then refused up front, rather than reported as a desync at tick 0.
+//
+
+#ifndef HASH_LOG_HPP
+#define HASH_LOG_HPP
+#include <algorithm>  // for std::min
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>  // for std::move
+#include <vector>
+
+#include "StateHash.hpp"
+
+class HashLog {
+public:
+    explicit HashLog(std::vector<std::string> subsystems) : subsystems_(std::move(subsystems)) {}
+
+    // ========================================================================
+    // Recording
+    // ========================================================================
+
+    // Append one tick. subsystemHashes must have one entry per subsystem.
+    void append(uint64_t tick, std::span<const uint64_t> subsystemHashes) {
+        rows_.push_back(tick);
+        rows_.push_back(StateHasher::hash(subsystemHashes.data(), subsystemHashes.size_bytes()));
+        rows_.insert(rows_.end(), subsystemHashes.begin(), subsystemHashes.end());
+    }
+
+    // Settings a log is only comparable under (saved with the log)
+    void setConfig(std::string config) { config_ = std::move(config); }
+
+    void reserve(size_t ticks) { rows_.reserve(ticks * stride()); }
+    void clear() { rows_.clear(); }
+
+    // ========================================================================
+    // Reading
+    // ========================================================================
+
+    size_t size() const { return rows_.size() / stride(); }
+    const std::vector<std::string>& subsystems() const { return subsystems_; }
+    const std::string& config() const { return config_; }
+
+    uint64_t tick(size_t row) const { return rows_[row * stride()]; }
+    uint64_t combined(size_t row) const { return rows_[row * stride() + 1]; }
+    uint64_t subsystem(size_t row, size_t index) const { return rows_[row * stride() + 2 + index]; }
+
+    // ========================================================================
+    // File I/O
+    // ========================================================================
+    //
+    // Binary layout (little-endian):
+    //   "HLOG" | version u32 | config length u32 | config bytes | subsystem count u32
+    //   per subsystem: name length u32 | name bytes
+    //   row count u64 | rows (u64 each)
+    //
+
+    bool save(const std::string& path) const {
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        file.write(MAGIC, 4);
+        writePod(file, VERSION);
+        writePod(file, static_cast<uint32_t>(config_.size()));
+        file.write(config_.data(), static_cast<std::streamsize>(config_.size()));
+        writePod(file, static_cast<uint32_t>(subsystems_.size()));
+        for (const std::string& name : subsystems_) {
+            writePod(file, static_cast<uint32_t>(name.size()));
+            file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+        writePod(file, static_cast<uint64_t>(size()));
+        file.write(reinterpret_cast<const char*>(rows_.data()),
+                   static_cast<std::streamsize>(rows_.size() * sizeof(uint64_t)));
+        return file.good();
+    }
+
+    // Returns nullopt if the file is missing, truncated or from another version
+    static std::optional<HashLog> load(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return std::nullopt;
+
+        char magic[4] = {};
+        uint32_t version = 0;
+        file.read(magic, 4);
+        readPod(file, version);
+        if (!file || std::string(magic, 4) != std::string(MAGIC, 4) || version != VERSION) {
+            return std::nullopt;
+        }
+
+        uint32_t configLength = 0;
+        readPod(file, configLength);
+        if (!file || configLength > 4096) return std::nullopt;
+        std::string config(configLength, '\0');
+        file.read(config.data(), configLength);
+
+        uint32_t count = 0;
+        readPod(file, count);
+        if (!file) return std::nullopt;
+
+        std::vector<std::string> names(count);
+        for (std::string& name : names) {
+            uint32_t length = 0;
+            readPod(file, length);
+            if (!file || length > 4096) return std::nullopt;
+            name.resize(length);
+            file.read(name.data(), length);
+        }
+
+        HashLog log(std::move(names));
+        log.config_ = std::move(config);
+        uint64_t rowCount = 0;
+        readPod(file, rowCount);
+        if (!file || rowCount > (uint64_t{1} << 32)) return std::nullopt;
+        log.rows_.resize(static_cast<size_t>(rowCount) * log.stride());
+        file.read(reinterpret_cast<char*>(log.rows_.data()),
+                  static_cast<std::streamsize>(log.rows_.size() * sizeof(uint64_t)));
+        if (!file) return std::nullopt;
+        return log;
+    }
+
+private:
+    static constexpr char MAGIC[4] = {'H', 'L', 'O', 'G'};
+    static constexpr uint32_t VERSION = 2;  // 2: config string
+
+    size_t stride() const { return subsystems_.size() + 2; }
+
+    template <typename T>
+    static void writePod(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static void readPod(std::ifstream& file, T& value) {
+        file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    std::vector<std::string> subsystems_;
+    std::string config_;
+    std::vector<uint64_t> rows_;
+};
+
+// ============================================================================
+// Desync Detection
+// ============================================================================
+
+struct Desync {
+    size_t row = 0;          // Index into both logs
+    uint64_t tick = 0;       // Simulation tick of the first divergence
+    std::string subsystem;   // First subsystem whose hash differs
+};
+
+// Compare two logs row by row over their common length.
+// Returns the first diverging tick, or nullopt if they agree.
+inline std::optional<Desync> findFirstDesync(const HashLog& a, const HashLog& b) {
+    if (a.subsystems() != b.subsystems()) {
+        return Desync{0, 0, "<subsystem list differs>"};
+    }
+
+    size_t rows = std::min(a.size(), b.size());
+    for (size_t row = 0; row < rows; ++row) {
+        if (a.tick(row) != b.tick(row)) {
+            return Desync{row, a.tick(row), "<tick numbers differ>"};
+        }
+        if (a.combined(row) == b.combined(row)) continue;
+
+        for (size_t s = 0; s < a.subsystems().size(); ++s) {
+            if (a.subsystem(row, s) != b.subsystem(row, s)) {
+                return Desync{row, a.tick(row), a.subsystems()[s]};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+#endif  // HASH_LOG_HPP
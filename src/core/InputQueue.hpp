@@ -0,0 +1,185 @@
+// InputQueue.hpp - Timestamped Input Events, Delivered to the Right Tick
+// ============================================================================
+// PURPOSE: glfwPollEvents() runs once per rendered frame, so sampling keys
+// with glfwGetKey() loses WHEN an input happened and applies it up to a
+// frame late. Instead, the GLFW key/mouse callbacks push each event, stamped
+// with the high-resolution clock, into a lock-free queue, and every fixed
+// tick takes exactly the events that happened inside its slice of time.
+//
+// WHICH TICK OWNS AN EVENT:
+//
+//   The game loop banks real time and simulates it in fixed steps, so the
+//   simulation always trails the wall clock by the banked remainder. The
+//   tick being run covers wall time up to
+//
+//     frameTime - (accumulator - fixedDt) / timeScale
+//
+//   (see tickWindowEnd()). Events stamped before that are delivered to it;
+//   later ones wait for the next tick, possibly in the next frame. While
+//   paused or in turbo, real time doesn't map to ticks: everything pending
+//   goes to the next tick that runs.
+//
+// LATENCY: every delivered event adds (delivery time - stamp) to the
+// input-to-tick histogram, and (present time - stamp) to input-to-present
+// once markPresented() is called after the buffer swap. When another thread
+// presents (render-thread mode), markSubmitted() tags the events a frame
+// carries and markPresented(frame, seconds) closes exactly those.
+//
+// The producer (GLFW callbacks) and consumer (fixed ticks) may be different
+// threads. A full queue drops the newest event and counts it.
+//
+
+#ifndef INPUT_QUEUE_HPP
+#define INPUT_QUEUE_HPP
+#include <atomic>
+#include <chrono>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t, uint64_t
+#include <vector>
+
+#include "LatencyHistogram.hpp"
+#include "SpscQueue.hpp"
+#include "Timer.hpp"
+
+enum class InputDevice : uint8_t { Key, MouseButton };
+
+struct InputEvent {
+    double seconds = 0.0;  // Clock time the callback ran (see BasicInputQueue::now())
+    InputDevice device = InputDevice::Key;
+    int32_t code = 0;      // GLFW key or mouse button
+    int32_t action = 0;    // GLFW_PRESS / GLFW_RELEASE / GLFW_REPEAT
+    int32_t mods = 0;
+};
+
+// Wall-clock end of the tick a game loop is running right now. Call from
+// inside the update callback, where accumulator still includes that tick.
+inline double tickWindowEnd(double frameSeconds, double accumulator, double fixedDt, double timeScale) {
+    if (!(timeScale > 0.0)) return frameSeconds;
+    return frameSeconds - (accumulator - fixedDt) / timeScale;
+}
+
+template <typename Clock = Timer::Clock>
+class BasicInputQueue {
+public:
+    static constexpr size_t CAPACITY = 1024;
+
+    BasicInputQueue() { awaitingPresent_.reserve(CAPACITY); }
+
+    // Timestamps and tick windows use this timebase (seconds)
+    static double now() {
+        return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+    }
+
+    // ========================================================================
+    // Producer Side (input callbacks)
+    // ========================================================================
+
+    bool push(InputDevice device, int code, int action, int mods) {
+        if (queue_.push({now(), device, code, action, mods})) return true;
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // ========================================================================
+    // Consumer Side (fixed ticks)
+    // ========================================================================
+
+    // Hands every event stamped before windowEnd to handle(event), oldest
+    // first, and records its input-to-tick latency. Returns the count.
+    template <typename Handler>
+    size_t deliverUntil(double windowEnd, Handler&& handle) {
+        double delivered = now();
+        size_t count = 0;
+        while (const InputEvent* front = queue_.peek()) {
+            if (front->seconds >= windowEnd) break;
+            InputEvent event = *front;
+            queue_.discardFront();
+
+            toTick_.add((delivered - event.seconds) * 1000.0);
+            if (awaitingPresent_.size() < CAPACITY) awaitingPresent_.push_back({event.seconds, UNSUBMITTED});
+            handle(event);
+            ++count;
+        }
+        return count;
+    }
+
+    // Drops everything stamped before windowEnd without delivering it
+    // (input that arrived while the simulation was paused)
+    size_t discardUntil(double windowEnd) {
+        size_t count = 0;
+        while (const InputEvent* front = queue_.peek()) {
+            if (front->seconds >= windowEnd) break;
+            queue_.discardFront();
+            ++count;
+        }
+        discarded_ += count;
+        return count;
+    }
+
+    // Call right after the buffer swap: events delivered since the last
+    // present are now visible on screen
+    void markPresented() {
+        double presented = now();
+        for (const Awaiting& event : awaitingPresent_) toPresent_.add((presented - event.seconds) * 1000.0);
+        awaitingPresent_.clear();
+    }
+
+    // Render-thread mode: call when a frame is handed off. Events delivered
+    // since the last call ride with it; returns its id for markPresented().
+    uint64_t markSubmitted() {
+        ++submitted_;
+        for (Awaiting& event : awaitingPresent_) {
+            if (event.frame == UNSUBMITTED) event.frame = submitted_;
+        }
+        return submitted_;
+    }
+
+    // Frame `frame` (and every earlier one) reached the screen at `presented`
+    void markPresented(uint64_t frame, double presented) {
+        size_t kept = 0;
+        for (const Awaiting& event : awaitingPresent_) {
+            if (event.frame <= frame) {
+                toPresent_.add((presented - event.seconds) * 1000.0);
+            } else {
+                awaitingPresent_[kept++] = event;
+            }
+        }
+        awaitingPresent_.resize(kept);
+    }
+
+    // ========================================================================
+    // Results (consumer thread)
+    // ========================================================================
+
+    const LatencyHistogram& inputToTick() const { return toTick_; }
+    const LatencyHistogram& inputToPresent() const { return toPresent_; }
+
+    size_t pending() const { return queue_.size(); }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+    uint64_t discarded() const { return discarded_; }
+
+    void clearLatency() {
+        toTick_.clear();
+        toPresent_.clear();
+    }
+
+private:
+    SpscQueue<InputEvent, CAPACITY> queue_;
+    std::atomic<uint64_t> dropped_{0};
+    uint64_t discarded_ = 0;
+
+    static constexpr uint64_t UNSUBMITTED = UINT64_MAX;
+
+    struct Awaiting {
+        double seconds;  // Event stamp
+        uint64_t frame;  // markSubmitted() id, UNSUBMITTED until then
+    };
+
+    std::vector<Awaiting> awaitingPresent_;  // Delivered, not yet presented
+    uint64_t submitted_ = 0;
+    LatencyHistogram toTick_;
+    LatencyHistogram toPresent_;
+};
+
+using InputQueue = BasicInputQueue<>;
+#endif  // INPUT_QUEUE_HPP
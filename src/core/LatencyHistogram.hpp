@@ -0,0 +1,71 @@
+// LatencyHistogram.hpp - Fixed-Size Log-Scale Latency Distribution
+// ============================================================================
+// PURPOSE: Record millions of latency samples (input-to-tick, input-to-
+// present, ...) and read back percentiles without storing the samples.
+// Same binning idea as FrametimeLevels: 8 bins per octave, so any
+// percentile is within ~9% of the true value, from 10 us up to ~40 s.
+// add() is O(1) and never allocates; percentile() walks the ~180 bins.
+//
+
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+#include <algorithm>  // for std::min, std::max, std::clamp
+#include <array>
+#include <cmath>    // for std::log2, std::exp2
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+
+class LatencyHistogram {
+public:
+    static constexpr double MIN_MS = 0.01;
+    static constexpr int BINS_PER_OCTAVE = 8;
+    static constexpr size_t BINS = 22 * BINS_PER_OCTAVE + 1;
+
+    void add(double ms) {
+        minimum_ = count_ == 0 ? ms : std::min(minimum_, ms);
+        maximum_ = count_ == 0 ? ms : std::max(maximum_, ms);
+        sum_ += ms;
+        ++count_;
+        ++bins_[binFor(ms)];
+    }
+
+    // q in [0, 1], e.g. 0.99. Upper edge of the bin holding that rank,
+    // clamped to the observed min/max (0 when empty).
+    double percentile(double q) const {
+        if (count_ == 0) return 0.0;
+        uint64_t rank = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(count_ - 1));
+        uint64_t seen = 0;
+        size_t bin = 0;
+        for (; bin < BINS - 1; ++bin) {
+            seen += bins_[bin];
+            if (seen > rank) break;
+        }
+        return std::clamp(binLimit(bin), minimum_, maximum_);
+    }
+
+    uint64_t count() const { return count_; }
+    double mean() const { return count_ ? sum_ / static_cast<double>(count_) : 0.0; }
+    double minimum() const { return minimum_; }
+    double maximum() const { return maximum_; }
+
+    void clear() { *this = LatencyHistogram{}; }
+
+private:
+    static size_t binFor(double ms) {
+        if (!(ms > MIN_MS)) return 0;  // Also catches NaN
+        double bin = std::log2(ms / MIN_MS) * BINS_PER_OCTAVE;
+        return std::min(BINS - 1, static_cast<size_t>(bin) + 1);
+    }
+
+    // Upper edge of a bin in milliseconds
+    static double binLimit(size_t bin) {
+        return MIN_MS * std::exp2(static_cast<double>(bin) / BINS_PER_OCTAVE);
+    }
+
+    std::array<uint64_t, BINS> bins_{};
+    uint64_t count_ = 0;
+    double sum_ = 0.0;
+    double minimum_ = 0.0;
+    double maximum_ = 0.0;
+};
+#endif  // LATENCY_HISTOGRAM_HPP
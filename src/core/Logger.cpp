@@ -0,0 +1,251 @@
+// ============================================================================
+// Logger.cpp - Background Thread, Batching and Rotation
+// ============================================================================
+
+#include "Logger.hpp"
+
+#include <algorithm>  // for std::stable_sort
+#include <filesystem>
+#include <system_error>
+
+namespace {
+
+// Bumped after every retire(): a thread refused a ring only retries once
+// this has moved, so a full Logger doesn't take the register lock per call
+std::atomic<uint64_t> g_retirements{0};
+
+// The ring this thread writes to, and which Logger it belongs to. Leaving
+// (thread exit, or switching Logger) retires the ring for another thread.
+// A null ring with a logger id set means registration failed (all
+// MAX_THREADS rings in use) when the retirement count was `retiredSeen`.
+struct ThreadRing {
+    uint64_t logger = 0;
+    std::shared_ptr<log_detail::Ring> ring;
+    uint64_t retiredSeen = 0;
+
+    ~ThreadRing() { leave(); }
+    void leave() {
+        if (ring) {
+            ring->retire();
+            g_retirements.fetch_add(1, std::memory_order_release);
+        }
+        ring.reset();
+        logger = 0;
+    }
+};
+
+thread_local ThreadRing currentRing;
+
+}  // namespace
+
+Logger::Logger(LoggerConfig config) : config_(std::move(config)) {
+    // Rings index with a mask: round up to a power of two, at least 4 KiB
+    size_t ringBytes = 4096;
+    while (ringBytes < config_.ringBytes) ringBytes *= 2;
+    config_.ringBytes = ringBytes;
+    if (config_.maxFiles == 0) config_.maxFiles = 1;
+
+    if (!config_.path.empty()) {
+        std::error_code error;
+        std::filesystem::path path(config_.path);
+        if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), error);
+        file_ = std::fopen(config_.path.c_str(), "ab");
+        if (file_) {
+            uintmax_t size = std::filesystem::file_size(path, error);
+            fileBytes_ = error ? 0 : static_cast<size_t>(size);
+        }
+    }
+
+    pending_.reserve(4096);
+    drainedTo_.resize(MAX_THREADS);
+    thread_ = std::thread([this]() { run(); });
+}
+
+Logger::~Logger() {
+    if (global() == this) setGlobal(nullptr);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+    if (file_) std::fclose(file_);
+}
+
+// ============================================================================
+// Calling Threads
+// ============================================================================
+
+log_detail::Ring* Logger::threadRing() {
+    if (currentRing.logger == id_) {
+        // Registered, or refused and no ring has been retired since
+        if (currentRing.ring || currentRing.retiredSeen == g_retirements.load(std::memory_order_relaxed)) {
+            return currentRing.ring.get();
+        }
+    }
+    return registerThread();
+}
+
+log_detail::Ring* Logger::registerThread() {
+    currentRing.leave();  // Our ring in another Logger, if any
+    // Before the scan: a ring retired during it makes the next call retry
+    uint64_t retirements = g_retirements.load(std::memory_order_acquire);
+
+    std::lock_guard<std::mutex> lock(registerMutex_);
+    size_t count = ringCount_.load(std::memory_order_relaxed);
+
+    // Take over a retired ring, preferring one the drain has emptied, so
+    // short-lived threads reuse rings instead of using up MAX_THREADS
+    std::shared_ptr<log_detail::Ring> ring;
+    for (size_t i = 0; i < count; ++i) {
+        if (!rings_[i]->retired()) continue;
+        if (!ring || rings_[i]->empty()) ring = rings_[i];
+        if (ring->empty()) break;
+    }
+    if (ring) {
+        ring->adopt();
+    } else if (count == MAX_THREADS) {
+        // Remember the refusal: later calls count a drop without the lock
+        currentRing.logger = id_;
+        currentRing.retiredSeen = retirements;
+        return nullptr;
+    } else {
+        rings_[count] = std::make_shared<log_detail::Ring>(config_.ringBytes);
+        ring = rings_[count];
+        ringCount_.store(count + 1, std::memory_order_release);
+    }
+    currentRing.logger = id_;
+    currentRing.ring = ring;
+    return ring.get();
+}
+
+void Logger::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t ticket = ++flushRequested_;
+    wake_.notify_all();
+    flushed_.wait(lock, [this, ticket]() { return flushCompleted_ >= ticket || stopping_; });
+}
+
+uint64_t Logger::dropped() const {
+    uint64_t total = unregisteredDrops_.load(std::memory_order_relaxed);
+    size_t count = ringCount_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) total += rings_[i]->dropped.load(std::memory_order_relaxed);
+    return total;
+}
+
+// ============================================================================
+// Background Thread
+// ============================================================================
+
+void Logger::run() {
+    auto period = std::chrono::duration<double>(config_.flushIntervalSeconds);
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait_for(lock, period, [this]() { return stopping_ || flushRequested_ > flushCompleted_; });
+        bool stopping = stopping_;
+        uint64_t requested = flushRequested_;
+        lock.unlock();
+
+        // Keep going until the rings are empty, so a flush (or shutdown)
+        // covers everything logged before it
+        while (drain() > 0) {
+        }
+        if (file_) std::fflush(file_);
+
+        lock.lock();
+        flushCompleted_ = requested;
+        flushed_.notify_all();
+        if (stopping) return;
+    }
+}
+
+size_t Logger::drain() {
+    using log_detail::RecordHeader;
+    using log_detail::Ring;
+
+    // Gather every complete record, in ring order
+    pending_.clear();
+    size_t count = ringCount_.load(std::memory_order_acquire);
+    for (size_t r = 0; r < count; ++r) {
+        Ring& ring = *rings_[r];
+        size_t head = ring.head();
+        size_t position = ring.tail();
+        while (position != head) {
+            uint32_t bytes = 0;
+            std::memcpy(&bytes, ring.at(position), sizeof(bytes));
+            if (!(bytes & Ring::PADDING)) {
+                const auto* header = reinterpret_cast<const RecordHeader*>(ring.at(position));
+                pending_.push_back({header->nanoseconds, r, header});
+            }
+            position += bytes & ~Ring::PADDING;
+        }
+        drainedTo_[r] = head;
+    }
+
+    // Threads interleave by time; each ring is already in order
+    std::stable_sort(pending_.begin(), pending_.end(),
+                     [](const Pending& a, const Pending& b) { return a.nanoseconds < b.nanoseconds; });
+
+    fileBatch_.clear();
+    consoleBatch_.clear();
+    for (const Pending& record : pending_) {
+        const RecordHeader& header = *record.header;
+        size_t lineStart = fileBatch_.size();
+        // Integer seconds.microseconds: formatting a double costs more than the message
+        int64_t micros = header.nanoseconds / 1000;
+        fmt::format_to(fmt::appender(fileBatch_), "[{:5}.{:06}] {} t{:<2} ", micros / 1000000,
+                       micros % 1000000, LOG_LEVEL_NAMES[static_cast<size_t>(header.level)], record.ring);
+        header.decode(reinterpret_cast<const std::byte*>(&header + 1),
+                      std::string_view(header.format, header.formatSize), fileBatch_);
+        fileBatch_.push_back('\n');
+        if (header.level >= config_.consoleLevel) {
+            consoleBatch_.append(fileBatch_.data() + lineStart, fileBatch_.data() + fileBatch_.size());
+        }
+    }
+
+    // Formatting read the argument bytes in place; only now hand them back
+    for (size_t r = 0; r < count; ++r) rings_[r]->release(drainedTo_[r]);
+
+    uint64_t dropped = this->dropped();
+    if (dropped > droppedReported_) {
+        std::string line = fmt::format("[logger] dropped {} messages (rings full)\n", dropped - droppedReported_);
+        droppedReported_ = dropped;
+        fileBatch_.append(line.data(), line.data() + line.size());
+        if (LogLevel::Warn >= config_.consoleLevel) consoleBatch_.append(line.data(), line.data() + line.size());
+    }
+
+    if (fileBatch_.size() > 0) writeFile(fileBatch_);
+    if (consoleBatch_.size() > 0) {
+        std::fwrite(consoleBatch_.data(), 1, consoleBatch_.size(), stderr);
+        std::fflush(stderr);
+    }
+    written_.fetch_add(pending_.size(), std::memory_order_relaxed);
+    return pending_.size();
+}
+
+void Logger::writeFile(const fmt::memory_buffer& batch) {
+    // Rotate before a batch that would overflow, so the newest lines are
+    // always in the current file (a batch is never split)
+    if (file_ && fileBytes_ > 0 && fileBytes_ + batch.size() > config_.maxFileBytes) rotate();
+    if (!file_) return;
+    std::fwrite(batch.data(), 1, batch.size(), file_);
+    fileBytes_ += batch.size();
+}
+
+// app.log -> app.log.1 -> ... -> app.log.<maxFiles-1> (the oldest is removed)
+void Logger::rotate() {
+    std::fclose(file_);
+    file_ = nullptr;
+
+    std::error_code error;
+    auto numbered = [this](size_t n) { return config_.path + "." + std::to_string(n); };
+    if (config_.maxFiles > 1) {
+        std::filesystem::remove(numbered(config_.maxFiles - 1), error);
+        for (size_t n = config_.maxFiles - 1; n > 1; --n) {
+            std::filesystem::rename(numbered(n - 1), numbered(n), error);
+        }
+        std::filesystem::rename(config_.path, numbered(1), error);
+    }
+    file_ = std::fopen(config_.path.c_str(), "wb");
+    fileBytes_ = 0;
+}
@@ -0,0 +1,343 @@
+// Logger.hpp - Asynchronous Structured Logger (Per-Thread Lock-Free Rings)
+// ============================================================================
+// PURPOSE: Diagnostics from the frame loop without the frame paying for
+// them. fmt::print(stderr, ...) formats on the calling thread and then
+// blocks in write() on a terminal or disk that may be slow; under load that
+// shows up as hitches. Here the calling thread only copies:
+//
+//   logInfo("Serving metrics on port {}", port);
+//   logWarn("Settings load error: {}", e.what());
+//
+// HOT PATH (calling thread, no locks, no allocation, no formatting):
+//
+//   The format string's address is its ID (it must be a literal: fmt's
+//   compile-time check already requires a constant). The ID, a decode
+//   function for this exact list of argument types, a timestamp and the
+//   raw argument bytes go into this thread's ring. Strings are copied in
+//   (the caller's buffer may be gone by the time it's formatted). If the
+//   ring is full the message is dropped and counted — logging never waits.
+//
+// BACKGROUND THREAD: every few milliseconds (or on flush()) it takes what
+// every ring holds, orders it by timestamp, formats it with fmt and writes
+// the whole batch with one fwrite. The file rotates at maxFileBytes
+// (app.log -> app.log.1 -> ... -> app.log.<maxFiles-1>). Messages at
+// consoleLevel and above are echoed to stderr from the same thread.
+//
+// One Logger is installed as the process-wide target with setGlobal();
+// the log*() functions are no-ops until then.
+//
+// RINGS: a thread gets a ring on its first message. When the thread exits
+// (or moves on to another Logger) its ring is retired; the next thread to
+// register takes it over instead of adding one, and the background thread
+// still drains what the old owner left in it. MAX_THREADS therefore limits
+// threads logging at the same time, not threads over the process lifetime.
+// A thread that finds every ring in use has its messages dropped (counted)
+// without taking a lock, and tries again only after some ring is retired.
+//
+
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+#include <fmt/format.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>  // for size_t, std::byte
+#include <cstdint>  // for uint32_t, uint64_t
+#include <cstdio>   // for std::FILE
+#include <cstring>  // for std::memcpy
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+enum class LogLevel : uint8_t { Debug, Info, Warn, Error, Off };
+
+inline constexpr std::array<const char*, 4> LOG_LEVEL_NAMES = {"DEBUG", "INFO ", "WARN ", "ERROR"};
+
+struct LoggerConfig {
+    std::string path;                        // Empty: console only
+    size_t maxFileBytes = 8 * 1024 * 1024;   // Rotate past this
+    size_t maxFiles = 3;                     // Current file + rotated ones
+    size_t ringBytes = 1024 * 1024;          // Per logging thread (power of two)
+    LogLevel level = LogLevel::Debug;        // Dropped on the calling thread below this
+    LogLevel consoleLevel = LogLevel::Info;  // Also echoed to stderr at or above this
+    double flushIntervalSeconds = 0.005;     // Background drain period
+};
+
+namespace log_detail {
+
+// Arguments as stored in the ring: strings become (length, bytes) and come
+// back as string_views into the ring; everything else is copied raw
+template <typename T>
+using Stored = std::conditional_t<std::is_convertible_v<const T&, std::string_view>, std::string_view, T>;
+
+template <typename T>
+size_t encodedSize(const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        return sizeof(uint32_t) + std::string_view(value).size();
+    } else {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>,
+                      "log arguments are copied raw: numbers, enums, pointers and strings only");
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+std::byte* encode(std::byte* out, const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        std::string_view text(value);
+        uint32_t length = static_cast<uint32_t>(text.size());
+        std::memcpy(out, &length, sizeof(length));
+        if (length > 0) std::memcpy(out + sizeof(length), text.data(), length);
+        return out + sizeof(length) + length;
+    } else {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template <typename T>
+const std::byte* decode(const std::byte* in, T& value) {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        uint32_t length = 0;
+        std::memcpy(&length, in, sizeof(length));
+        value = std::string_view(reinterpret_cast<const char*>(in + sizeof(length)), length);
+        return in + sizeof(length) + length;
+    } else {
+        std::memcpy(&value, in, sizeof(T));
+        return in + sizeof(T);
+    }
+}
+
+using DecodeFn = void (*)(const std::byte* args, std::string_view format, fmt::memory_buffer& out);
+
+// Instantiated once per argument-type list; runs on the background thread
+template <typename... Ts>
+void formatRecord(const std::byte* args, std::string_view format, fmt::memory_buffer& out) {
+    std::tuple<Ts...> values;
+    std::apply([&args](auto&... value) { ((args = decode(args, value)), ...); }, values);
+    std::apply(
+        [&](auto&... value) {
+            fmt::vformat_to(fmt::appender(out), fmt::string_view(format.data(), format.size()),
+                            fmt::make_format_args(value...));
+        },
+        values);
+}
+
+// Every message starts with this, then its encoded arguments
+struct RecordHeader {
+    uint32_t bytes;  // Whole record, rounded up to 8; PADDING bit: skip to ring start
+    uint32_t formatSize;
+    const char* format;
+    DecodeFn decode;
+    int64_t nanoseconds;  // Since the Logger started
+    LogLevel level;
+};
+
+// Single-producer (the owning thread) / single-consumer (the background
+// thread) ring of variable-size records. Ownership passes between threads
+// through retire() / adopt(): the producer side is only ever a head index,
+// so a new owner just carries on after the old owner's last record.
+class Ring {
+public:
+    static constexpr uint32_t PADDING = 0x80000000u;
+
+    explicit Ring(size_t bytes) : storage_(bytes / sizeof(uint64_t)) {}
+
+    size_t capacity() const { return storage_.size() * sizeof(uint64_t); }
+
+    // Owner: done with this ring (publishes every commit before it)
+    void retire() { retired_.store(true, std::memory_order_release); }
+    bool retired() const { return retired_.load(std::memory_order_acquire); }
+    // New owner (after seeing retired()): the ring is ours from here
+    void adopt() { retired_.store(false, std::memory_order_relaxed); }
+    bool empty() const { return head() == tail_.load(std::memory_order_acquire); }
+
+    // Producer: contiguous space for `bytes` (a multiple of 8), or null if full
+    std::byte* reserve(size_t bytes) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t offset = head & (capacity() - 1);
+        size_t toEnd = capacity() - offset;
+        size_t needed = bytes <= toEnd ? bytes : toEnd + bytes;  // Wrap: pad out the end first
+        if (capacity() - (head - tail) < needed) return nullptr;
+        if (bytes > toEnd) {
+            uint32_t padding = static_cast<uint32_t>(toEnd) | PADDING;
+            std::memcpy(data() + offset, &padding, sizeof(padding));
+            head_.store(head + toEnd, std::memory_order_release);
+            offset = 0;
+        }
+        return data() + offset;
+    }
+
+    // Producer: publishes the record written at reserve()
+    void commit(size_t bytes) {
+        head_.store(head_.load(std::memory_order_relaxed) + bytes, std::memory_order_release);
+    }
+
+    // Consumer: records between tail and a head snapshot, then release()
+    size_t head() const { return head_.load(std::memory_order_acquire); }
+    size_t tail() const { return tail_.load(std::memory_order_relaxed); }
+    const std::byte* at(size_t position) const { return data() + (position & (capacity() - 1)); }
+    void release(size_t position) { tail_.store(position, std::memory_order_release); }
+
+    std::atomic<uint64_t> dropped{0};
+
+private:
+    std::byte* data() { return reinterpret_cast<std::byte*>(storage_.data()); }
+    const std::byte* data() const { return reinterpret_cast<const std::byte*>(storage_.data()); }
+
+    std::vector<uint64_t> storage_;  // 8-aligned for the headers
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+    std::atomic<bool> retired_{false};
+};
+
+}  // namespace log_detail
+
+class Logger {
+public:
+    static constexpr size_t MAX_THREADS = 64;
+
+    explicit Logger(LoggerConfig config);
+    ~Logger();  // Drains everything still queued, then stops
+
+    // Non-copyable (owns a thread and threads hold pointers into it)
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // The target of logDebug() ... logError(); null to detach
+    static void setGlobal(Logger* logger) { global_.store(logger, std::memory_order_release); }
+    static Logger* global() { return global_.load(std::memory_order_acquire); }
+
+    bool enabled(LogLevel level) const { return level >= config_.level && level != LogLevel::Off; }
+
+    // Hot path: see the header comment. `format` must be a string literal.
+    template <typename... Args>
+    void write(LogLevel level, std::string_view format, const Args&... args) {
+        using log_detail::RecordHeader;
+        size_t bytes = (sizeof(RecordHeader) + (size_t{0} + ... + log_detail::encodedSize(args)) + 7) & ~size_t{7};
+        log_detail::Ring* ring = threadRing();
+        if (!ring || bytes > ring->capacity() / 2) {
+            unregisteredDrops_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::byte* out = ring->reserve(bytes);
+        if (!out) {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        RecordHeader header{static_cast<uint32_t>(bytes),
+                            static_cast<uint32_t>(format.size()),
+                            format.data(),
+                            &log_detail::formatRecord<log_detail::Stored<Args>...>,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_).count(),
+                            level};
+        std::memcpy(out, &header, sizeof(header));
+        std::byte* cursor = out + sizeof(header);
+        ((cursor = log_detail::encode(cursor, args)), ...);
+        (void)cursor;  // Unused when there are no arguments
+        ring->commit(bytes);
+    }
+
+    // Blocks until everything logged before the call is written out
+    void flush();
+
+    // Messages lost to full rings (or too many live threads), all threads so far
+    uint64_t dropped() const;
+
+    // Lines written to the file / console so far
+    uint64_t written() const { return written_.load(std::memory_order_relaxed); }
+
+    const LoggerConfig& config() const { return config_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    log_detail::Ring* threadRing();
+    log_detail::Ring* registerThread();
+    void run();
+    size_t drain();
+    void writeFile(const fmt::memory_buffer& batch);
+    void rotate();
+
+    static inline std::atomic<Logger*> global_{nullptr};
+    static inline std::atomic<uint64_t> nextId_{1};
+
+    LoggerConfig config_;
+    uint64_t id_ = nextId_.fetch_add(1);  // Tells this Logger's rings from an earlier one's
+    Clock::time_point start_ = Clock::now();
+
+    // Rings are only ever added (retired ones get new owners instead of
+    // being removed); slots below ringCount_ are immutable. Shared with the
+    // owning thread, whose exit may come after this Logger is gone.
+    std::array<std::shared_ptr<log_detail::Ring>, MAX_THREADS> rings_;
+    std::atomic<size_t> ringCount_{0};
+    std::mutex registerMutex_;
+    std::atomic<uint64_t> unregisteredDrops_{0};
+
+    // Background thread
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    uint64_t flushRequested_ = 0;
+    uint64_t flushCompleted_ = 0;
+    bool stopping_ = false;
+    std::atomic<uint64_t> written_{0};
+    uint64_t droppedReported_ = 0;
+
+    std::FILE* file_ = nullptr;
+    size_t fileBytes_ = 0;
+
+    // Reused batch storage (background thread only)
+    struct Pending {
+        int64_t nanoseconds;
+        size_t ring;
+        const log_detail::RecordHeader* header;
+    };
+    std::vector<Pending> pending_;
+    std::vector<size_t> drainedTo_;
+    fmt::memory_buffer fileBatch_;
+    fmt::memory_buffer consoleBatch_;
+
+    std::thread thread_;  // Last: starts after everything above exists
+};
+
+// ============================================================================
+// Logging Functions (global Logger)
+// ============================================================================
+
+template <typename... Args>
+void logAt(LogLevel level, fmt::format_string<Args...> format, Args&&... args) {
+    Logger* logger = Logger::global();
+    if (!logger || !logger->enabled(level)) return;
+    fmt::string_view text = format;
+    logger->write(level, std::string_view(text.data(), text.size()), args...);
+}
+
+template <typename... Args>
+void logDebug(fmt::format_string<Args...> format, Args&&... args) {
+    logAt<Args...>(LogLevel::Debug, format, std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+void logInfo(fmt::format_string<Args...> format, Args&&... args) {
+    logAt<Args...>(LogLevel::Info, format, std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+void logWarn(fmt::format_string<Args...> format, Args&&... args) {
+    logAt<Args...>(LogLevel::Warn, format, std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+void logError(fmt::format_string<Args...> format, Args&&... args) {
+    logAt<Args...>(LogLevel::Error, format, std::forward<Args>(args)...);
+}
+#endif  // LOGGER_HPP
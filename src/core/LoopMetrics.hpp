@@ -0,0 +1,158 @@
+// LoopMetrics.hpp - Loop Timing Counters and Histograms
+// ============================================================================
+// PURPOSE: Collect everything an external monitor wants to know about the
+// loop — frame/tick time distributions, tick rate, time dropped by the spiral
+// of death cap, pause state, allocation counts — into one plain struct that
+// can be copied across threads (see TripleBuffer) and rendered as OpenMetrics
+// text for a Prometheus scrape.
+//
+
+#ifndef LOOP_METRICS_HPP
+#define LOOP_METRICS_HPP
+#include <fmt/format.h>
+
+#include <array>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <iterator>  // for std::back_inserter
+#include <string>
+
+// ============================================================================
+// Histogram
+// Fixed buckets (no allocation), tuned around 60 Hz frame budgets.
+// ============================================================================
+
+struct Histogram {
+    // Upper bounds in seconds; one extra bucket catches everything above (+Inf)
+    static constexpr std::array<double, 11> BOUNDS = {
+        0.001, 0.002, 0.004, 0.008, 0.0125, 0.0167, 0.0333, 0.05, 0.1, 0.25, 1.0};
+
+    std::array<uint64_t, BOUNDS.size() + 1> buckets = {};  // NOT cumulative
+    double sum = 0.0;
+    uint64_t count = 0;
+
+    void observe(double seconds) {
+        size_t i = 0;
+        while (i < BOUNDS.size() && seconds > BOUNDS[i]) ++i;
+        ++buckets[i];
+        sum += seconds;
+        ++count;
+    }
+};
+
+// ============================================================================
+// Snapshot
+// Everything published once per frame. Trivially copyable on purpose.
+// ============================================================================
+
+struct LoopMetricsSnapshot {
+    Histogram frameTime;
+    Histogram tickTime;
+    uint64_t frames = 0;
+    uint64_t ticks = 0;
+    double ticksPerSecond = 0.0;
+    double droppedSeconds = 0.0;   // Real time discarded by GameLoop::MAX_FRAME_TIME
+    bool paused = false;
+    float timeScale = 1.0f;
+    uint64_t allocations = 0;      // operator new calls since startup
+    uint64_t liveAllocations = 0;  // allocations minus deallocations
+};
+
+// ============================================================================
+// LoopMetrics - Writer-Side Accumulator (frame loop only)
+// ============================================================================
+
+class LoopMetrics {
+public:
+    void recordTick(double seconds) {
+        snapshot_.tickTime.observe(seconds);
+        ++snapshot_.ticks;
+    }
+
+    // Call once per frame, after the fixed updates for that frame ran
+    void recordFrame(double frameSeconds) {
+        snapshot_.frameTime.observe(frameSeconds);
+        ++snapshot_.frames;
+
+        // Tick rate over a rolling ~1 second window of real time
+        rateWindowSeconds_ += frameSeconds;
+        if (rateWindowSeconds_ >= 1.0) {
+            snapshot_.ticksPerSecond =
+                static_cast<double>(snapshot_.ticks - rateWindowTicks_) / rateWindowSeconds_;
+            rateWindowTicks_ = snapshot_.ticks;
+            rateWindowSeconds_ = 0.0;
+        }
+    }
+
+    LoopMetricsSnapshot& snapshot() { return snapshot_; }
+    const LoopMetricsSnapshot& snapshot() const { return snapshot_; }
+
+private:
+    LoopMetricsSnapshot snapshot_;
+    double rateWindowSeconds_ = 0.0;
+    uint64_t rateWindowTicks_ = 0;
+};
+
+// ============================================================================
+// OpenMetrics Text Exposition
+// https://openmetrics.io — what Prometheus scrapes with
+// Accept: application/openmetrics-text
+// ============================================================================
+
+namespace openmetrics {
+
+inline void appendHistogram(std::string& out, const char* name, const char* help,
+                            const Histogram& h) {
+    auto it = std::back_inserter(out);
+    fmt::format_to(it, "# TYPE {} histogram\n# UNIT {} seconds\n# HELP {} {}\n", name, name,
+                   name, help);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < Histogram::BOUNDS.size(); ++i) {
+        cumulative += h.buckets[i];
+        fmt::format_to(it, "{}_bucket{{le=\"{}\"}} {}\n", name, Histogram::BOUNDS[i], cumulative);
+    }
+    cumulative += h.buckets.back();
+    fmt::format_to(it, "{}_bucket{{le=\"+Inf\"}} {}\n", name, cumulative);
+    fmt::format_to(it, "{}_sum {}\n{}_count {}\n", name, h.sum, name, h.count);
+}
+
+inline void appendScalar(std::string& out, const char* name, const char* type, const char* help,
+                         const char* sampleName, double value) {
+    fmt::format_to(std::back_inserter(out), "# TYPE {} {}\n# HELP {} {}\n{} {}\n", name, type,
+                   name, help, sampleName, value);
+}
+
+inline std::string format(const LoopMetricsSnapshot& m) {
+    std::string out;
+    out.reserve(4096);
+
+    appendHistogram(out, "loop_frame_time_seconds", "Real time between rendered frames.",
+                    m.frameTime);
+    appendHistogram(out, "loop_tick_time_seconds", "Wall time spent in one fixed update.",
+                    m.tickTime);
+
+    appendScalar(out, "loop_frames", "counter", "Frames rendered.", "loop_frames_total",
+                 static_cast<double>(m.frames));
+    appendScalar(out, "loop_ticks", "counter", "Fixed updates run.", "loop_ticks_total",
+                 static_cast<double>(m.ticks));
+    appendScalar(out, "loop_ticks_per_second", "gauge", "Fixed updates per real second.",
+                 "loop_ticks_per_second", m.ticksPerSecond);
+    appendScalar(out, "loop_dropped_time_seconds", "counter",
+                 "Real time discarded by the spiral-of-death cap.",
+                 "loop_dropped_time_seconds_total", m.droppedSeconds);
+    appendScalar(out, "loop_paused", "gauge", "1 while the simulation is paused.", "loop_paused",
+                 m.paused ? 1.0 : 0.0);
+    appendScalar(out, "loop_time_scale", "gauge", "Simulation time scale.", "loop_time_scale",
+                 static_cast<double>(m.timeScale));
+    appendScalar(out, "process_allocations", "counter", "Calls to operator new.",
+                 "process_allocations_total", static_cast<double>(m.allocations));
+    appendScalar(out, "process_live_allocations", "gauge", "Allocations not yet freed.",
+                 "process_live_allocations", static_cast<double>(m.liveAllocations));
+
+    out += "# EOF\n";
+    return out;
+}
+
+}  // namespace openmetrics
+
+#endif  // LOOP_METRICS_HPP
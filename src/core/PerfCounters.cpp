@@ -0,0 +1,233 @@
+// ============================================================================
+// PerfCounters.cpp - Implementation
+// ============================================================================
+
+#include "PerfCounters.hpp"
+
+#include <cstring>  // for std::memset, std::strerror
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#define PERF_COUNTERS_LINUX 1
+#endif
+
+#ifdef PERF_COUNTERS_LINUX
+
+namespace {
+
+struct CounterSpec {
+    uint32_t type;
+    uint64_t config;
+};
+
+// Indexed by PerfCounter. The hardware counters form the group; context
+// switches (a software event rdpmc can't read) stay on their own fd so the
+// group can still be read without a syscall.
+constexpr std::array<CounterSpec, PERF_COUNTERS> SPECS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},  // Last-level cache
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+}};
+
+int openCounter(const CounterSpec& spec, int groupFd, bool grouped) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = spec.type;
+    attr.config = spec.config;
+    attr.disabled = grouped && groupFd < 0 ? 1 : 0;  // The leader starts the whole group
+    // Hardware: user space only, allowed at paranoid <= 2. A context switch
+    // happens in the kernel, so excluding it would always count 0; that
+    // event needs paranoid <= 1 and open() falls back to getrusage().
+    attr.exclude_kernel = spec.type == PERF_TYPE_HARDWARE ? 1 : 0;
+    attr.exclude_hv = 1;
+    attr.read_format = grouped ? PERF_FORMAT_GROUP : 0;
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0 /* this thread */,
+                                      -1 /* any cpu */, grouped ? groupFd : -1, 0));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PERF_COUNTERS_RDPMC 1
+inline uint64_t rdpmc(uint32_t counter) {
+    uint32_t low = 0, high = 0;
+    __asm__ volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(counter));
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+#endif
+
+// One counter from its mmap page; false if it isn't readable from user space
+// right now (not scheduled, or rdpmc disabled), in which case use read()
+bool readUserPage(const void* mapping, uint64_t& out) {
+#ifdef PERF_COUNTERS_RDPMC
+    const volatile perf_event_mmap_page* page = static_cast<const volatile perf_event_mmap_page*>(mapping);
+    uint32_t sequence = 0;
+    do {
+        sequence = page->lock;
+        __asm__ volatile("" ::: "memory");
+        uint32_t index = page->index;
+        uint16_t width = page->pmc_width;
+        if (!page->cap_user_rdpmc || index == 0 || width == 0 || width > 64) return false;
+
+        uint64_t count = rdpmc(index - 1);
+        // Sign-extend from the counter's width, then add the kernel's base
+        int64_t value = static_cast<int64_t>(count << (64 - width)) >> (64 - width);
+        out = static_cast<uint64_t>(page->offset + value);
+        __asm__ volatile("" ::: "memory");
+    } while (page->lock != sequence);
+    return true;
+#else
+    (void)mapping;
+    (void)out;
+    return false;
+#endif
+}
+
+// Voluntary + involuntary switches of this thread so far (no permission needed)
+bool readRusageSwitches(uint64_t& out) {
+    rusage usage{};
+    if (::getrusage(RUSAGE_THREAD, &usage) != 0) return false;
+    out = static_cast<uint64_t>(usage.ru_nvcsw) + static_cast<uint64_t>(usage.ru_nivcsw);
+    return true;
+}
+
+}  // namespace
+
+bool PerfCounters::open() {
+    close();
+
+    std::string failed;
+    int firstErrno = 0;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i) {
+        bool grouped = SPECS[i].type == PERF_TYPE_HARDWARE;
+        int fd = openCounter(SPECS[i], leader_, grouped);
+        uint64_t unused = 0;
+        if (fd < 0 && static_cast<PerfCounter>(i) == PerfCounter::ContextSwitches && readRusageSwitches(unused)) {
+            rusageSwitches_ = true;  // Same count, one syscall, any paranoid level
+            opened_ |= 1u << i;
+            continue;
+        }
+        if (fd < 0) {
+            if (!firstErrno) firstErrno = errno;
+            failed += failed.empty() ? PERF_COUNTER_NAMES[i] : std::string(", ") + PERF_COUNTER_NAMES[i];
+            continue;
+        }
+        fds_[i] = fd;
+        opened_ |= 1u << i;
+        if (!grouped) continue;
+        if (leader_ < 0) leader_ = fd;
+        groupSlot_[i] = groupSize_++;
+    }
+
+    if (!failed.empty()) {
+        error_ = "unavailable: " + failed + " (" + std::strerror(firstErrno) + ")";
+        if (firstErrno == EACCES || firstErrno == EPERM) {
+            error_ += "; check /proc/sys/kernel/perf_event_paranoid";
+        }
+    }
+    if (leader_ < 0) return available();  // Software counters only
+
+    // rdpmc needs every hardware counter's page to allow it
+    long pageSize = ::sysconf(_SC_PAGESIZE);
+    rdpmc_ = true;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i) {
+        if (fds_[i] < 0 || SPECS[i].type != PERF_TYPE_HARDWARE) continue;
+        void* page = ::mmap(nullptr, static_cast<size_t>(pageSize), PROT_READ, MAP_SHARED, fds_[i], 0);
+        if (page == MAP_FAILED) {
+            rdpmc_ = false;
+            continue;
+        }
+        pages_[i] = page;
+        if (!static_cast<const perf_event_mmap_page*>(page)->cap_user_rdpmc) rdpmc_ = false;
+    }
+#ifndef PERF_COUNTERS_RDPMC
+    rdpmc_ = false;
+#endif
+
+    ::ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+}
+
+void PerfCounters::close() {
+    long pageSize = ::sysconf(_SC_PAGESIZE);
+    for (size_t i = 0; i < PERF_COUNTERS; ++i) {
+        if (pages_[i]) ::munmap(pages_[i], static_cast<size_t>(pageSize));
+        pages_[i] = nullptr;
+        if (fds_[i] >= 0) ::close(fds_[i]);
+        fds_[i] = -1;
+    }
+    leader_ = -1;
+    groupSize_ = 0;
+    opened_ = 0;
+    rdpmc_ = false;
+    rusageSwitches_ = false;
+    error_.clear();
+}
+
+bool PerfCounters::readGroup(PerfSample& out) const {
+    if (leader_ < 0) return true;  // No hardware group
+    // PERF_FORMAT_GROUP: { u64 nr; u64 values[nr]; }
+    std::array<uint64_t, 1 + PERF_COUNTERS> buffer{};
+    ssize_t bytes = ::read(leader_, buffer.data(), sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(sizeof(uint64_t) * (1 + groupSize_))) return false;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i) {
+        if (fds_[i] >= 0 && SPECS[i].type == PERF_TYPE_HARDWARE) out.values[i] = buffer[1 + groupSlot_[i]];
+    }
+    return true;
+}
+
+PerfSample PerfCounters::read() const {
+    PerfSample sample;
+
+    // Hardware group: rdpmc per counter, or one read() if any page refuses
+    bool complete = rdpmc_;
+    for (size_t i = 0; i < PERF_COUNTERS && complete; ++i) {
+        if (pages_[i]) complete = readUserPage(pages_[i], sample.values[i]);
+    }
+    if (!complete) readGroup(sample);
+
+    // Context switches: software event, always a read() (or getrusage())
+    size_t switches = static_cast<size_t>(PerfCounter::ContextSwitches);
+    if (rusageSwitches_) {
+        readRusageSwitches(sample.values[switches]);
+    } else if (fds_[switches] >= 0) {
+        uint64_t value = 0;
+        if (::read(fds_[switches], &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+            sample.values[switches] = value;
+        }
+    }
+    return sample;
+}
+
+#else
+
+bool PerfCounters::open() {
+    error_ = "hardware counters are only supported on Linux";
+    return false;
+}
+
+void PerfCounters::close() {
+    fds_.fill(-1);
+    pages_.fill(nullptr);
+    groupSlot_.fill(0);
+    leader_ = -1;
+    groupSize_ = 0;
+    opened_ = 0;
+    rdpmc_ = false;
+    rusageSwitches_ = false;
+}
+
+bool PerfCounters::readGroup(PerfSample&) const { return false; }
+
+PerfSample PerfCounters::read() const { return {}; }
+
+#endif  // PERF_COUNTERS_LINUX
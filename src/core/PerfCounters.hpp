@@ -0,0 +1,210 @@
+// PerfCounters.hpp - Hardware Performance Counters (Linux perf_event)
+// ============================================================================
+// PURPOSE: Wall-clock time says a tick was slow, not why. Counting cycles,
+// instructions, last-level cache misses, branch misses and context switches
+// around a frame, a fixed update or a profiler zone tells cache-bound from
+// branchy from "the OS took the core away".
+//
+// HOW IT WORKS (Linux):
+//
+//   The hardware counters are opened as ONE perf_event group on the calling
+//   thread, user space only (so the default perf_event_paranoid=2 allows
+//   it). A group is scheduled onto the PMU all-or-nothing, so ratios like
+//   IPC are always taken over the same interval.
+//
+//   Reading the group is a few hundred cycles on x86: each counter's mmap'd
+//   page says which PMU register holds it and rdpmc reads that register
+//   directly, no syscall. If rdpmc isn't allowed (or on other CPUs) one
+//   read() syscall fetches the whole group instead. Context switches are a
+//   software event on their own fd and always cost one read(). They happen
+//   in the kernel, so that event must include kernel mode (paranoid <= 1);
+//   where it can't, getrusage(RUSAGE_THREAD) counts the same switches.
+//
+// FALLBACK: any counter that can't be opened (no PMU in a VM, paranoid=3,
+// seccomp, not Linux) is simply absent — has() says which ones exist and
+// error() says why. With none available, read() returns zeros, so callers
+// never need a separate code path.
+//
+// Counters are per thread: open() and read() on the thread being measured.
+//
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+#include <fmt/core.h>
+
+#include <array>
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint64_t
+#include <iterator>  // for std::back_inserter
+#include <string>
+#include <vector>
+
+enum class PerfCounter { Cycles, Instructions, LlcMisses, BranchMisses, ContextSwitches, COUNT };
+
+inline constexpr size_t PERF_COUNTERS = static_cast<size_t>(PerfCounter::COUNT);
+
+inline constexpr std::array<const char*, PERF_COUNTERS> PERF_COUNTER_NAMES = {
+    "cycles", "instructions", "llc_misses", "branch_misses", "context_switches"};
+
+// Raw counts at one instant, or the difference between two instants
+struct PerfSample {
+    std::array<uint64_t, PERF_COUNTERS> values{};
+
+    uint64_t operator[](PerfCounter counter) const { return values[static_cast<size_t>(counter)]; }
+
+    PerfSample operator-(const PerfSample& earlier) const {
+        PerfSample delta;
+        for (size_t i = 0; i < PERF_COUNTERS; ++i) delta.values[i] = values[i] - earlier.values[i];
+        return delta;
+    }
+
+    PerfSample& operator+=(const PerfSample& other) {
+        for (size_t i = 0; i < PERF_COUNTERS; ++i) values[i] += other.values[i];
+        return *this;
+    }
+};
+
+class PerfCounters {
+public:
+    PerfCounters() = default;
+    ~PerfCounters() { close(); }
+
+    // Non-copyable (owns file descriptors and mappings)
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // Opens as many counters as the system allows and starts them.
+    // Returns true if at least one is counting.
+    bool open();
+    void close();
+
+    bool available() const { return opened_ != 0; }
+    bool has(PerfCounter counter) const { return (opened_ >> static_cast<unsigned>(counter)) & 1u; }
+
+    // True if hardware counters are read with rdpmc (no syscall)
+    bool usesRdpmc() const { return rdpmc_; }
+
+    // Why counters are missing ("" if all opened)
+    const std::string& error() const { return error_; }
+
+    // Current counts (missing counters read 0). Cheap enough per zone.
+    PerfSample read() const;
+
+private:
+    bool readGroup(PerfSample& out) const;
+
+    std::array<int, PERF_COUNTERS> fds_{-1, -1, -1, -1, -1};
+    std::array<void*, PERF_COUNTERS> pages_{};  // mmap'd perf_event_mmap_page, hardware only
+    std::array<size_t, PERF_COUNTERS> groupSlot_{};  // Position in a PERF_FORMAT_GROUP read
+    int leader_ = -1;  // First hardware counter (-1: no hardware group)
+    size_t groupSize_ = 0;
+    unsigned opened_ = 0;  // Bit per PerfCounter
+    bool rdpmc_ = false;
+    bool rusageSwitches_ = false;  // Context switches from getrusage(), not perf
+    std::string error_;
+};
+
+// ============================================================================
+// PerfStats - Accumulated Deltas for One Zone
+// ============================================================================
+
+struct PerfStats {
+    uint64_t samples = 0;  // Frames / ticks / zone entries
+    PerfSample total;
+
+    void add(const PerfSample& delta) {
+        ++samples;
+        total += delta;
+    }
+
+    // Instructions per cycle (0 without both counters)
+    double ipc() const {
+        uint64_t cycles = total[PerfCounter::Cycles];
+        return cycles ? static_cast<double>(total[PerfCounter::Instructions]) / static_cast<double>(cycles)
+                      : 0.0;
+    }
+
+    // Average count per sample, e.g. LLC misses per tick
+    double perSample(PerfCounter counter) const {
+        return samples ? static_cast<double>(total[counter]) / static_cast<double>(samples) : 0.0;
+    }
+
+    void clear() { *this = PerfStats{}; }
+};
+
+// Measures one zone (RAII, like ScopedTimer). Does nothing without counters.
+class PerfScope {
+public:
+    PerfScope(const PerfCounters& counters, PerfStats& stats)
+        : counters_(counters), stats_(stats), start_(counters.available() ? counters.read() : PerfSample{}) {}
+
+    ~PerfScope() {
+        if (counters_.available()) stats_.add(counters_.read() - start_);
+    }
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+private:
+    const PerfCounters& counters_;
+    PerfStats& stats_;
+    PerfSample start_;
+};
+// ============================================================================
+// PerfZones - Named Zones over a Rolling Window
+// ============================================================================
+//
+// Stats accumulate into each zone's open window; roll() (e.g. once a
+// second) publishes it, so a panel shows steady numbers rather than one
+// frame's noise.
+//
+
+class PerfZones {
+public:
+    // Returns the zone's index (name must be a string literal)
+    size_t add(const char* name) {
+        zones_.push_back({name, {}, {}});
+        return zones_.size() - 1;
+    }
+
+    PerfStats& open(size_t zone) { return zones_[zone].open; }
+    const PerfStats& last(size_t zone) const { return zones_[zone].last; }
+    const char* name(size_t zone) const { return zones_[zone].name; }
+    size_t size() const { return zones_.size(); }
+
+    void roll() {
+        for (Zone& zone : zones_) {
+            zone.last = zone.open;
+            zone.open.clear();
+        }
+    }
+
+private:
+    struct Zone {
+        const char* name;
+        PerfStats open;
+        PerfStats last;
+    };
+    std::vector<Zone> zones_;
+};
+
+// One line for headless reports, e.g.
+//   "IPC 1.92  llc_misses 310.5  branch_misses 88.0  context_switches 0.02 per tick"
+// Counters that aren't available are left out.
+inline std::string perfSummary(const PerfStats& stats, const PerfCounters& counters, const char* per) {
+    std::string out;
+    auto it = std::back_inserter(out);
+    if (counters.has(PerfCounter::Cycles) && counters.has(PerfCounter::Instructions)) {
+        fmt::format_to(it, "IPC {:.2f}  ", stats.ipc());
+    }
+    for (PerfCounter counter : {PerfCounter::LlcMisses, PerfCounter::BranchMisses,
+                                PerfCounter::ContextSwitches}) {
+        if (counters.has(counter)) {
+            fmt::format_to(it, "{} {:.2f}  ", PERF_COUNTER_NAMES[static_cast<size_t>(counter)],
+                           stats.perSample(counter));
+        }
+    }
+    fmt::format_to(it, "per {} ({} samples)", per, stats.samples);
+    return out;
+}
+#endif  // PERF_COUNTERS_HPP
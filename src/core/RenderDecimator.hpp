@@ -0,0 +1,57 @@
+// RenderDecimator.hpp - Skip Rendering While the Simulation Runs Flat Out
+// ============================================================================
+// PURPOSE: In turbo mode every millisecond spent rendering (and waiting on
+// vsync) is a millisecond not spent simulating. The decimator decides which
+// loop iterations actually draw:
+// - every Nth iteration, and/or
+// - at most `hz` times per second of wall-clock time (e.g. 10 Hz)
+//
+// Both limits can be combined; a frame renders only when both allow it.
+// Application's turbo mode starts at 10 Hz; the timing panel sets both.
+//
+
+#ifndef RENDER_DECIMATOR_HPP
+#define RENDER_DECIMATOR_HPP
+#include <cstdint>  // for uint64_t
+
+class RenderDecimator {
+public:
+    // 0 or 1 = no frame-count limit
+    void setEveryNthFrame(unsigned n) { everyNth_ = n; }
+
+    // 0 = no wall-clock limit
+    void setMaxRate(double hz) { minInterval_ = hz > 0.0 ? 1.0 / hz : 0.0; }
+
+    unsigned everyNthFrame() const { return everyNth_; }
+    double maxRate() const { return minInterval_ > 0.0 ? 1.0 / minInterval_ : 0.0; }
+
+    // Call once per loop iteration with the wall time since the previous one
+    bool shouldRender(double frameSeconds) {
+        ++frames_;
+        sinceLastRender_ += frameSeconds;
+
+        bool countOk = everyNth_ <= 1 || frames_ % everyNth_ == 0;
+        bool rateOk = sinceLastRender_ >= minInterval_;
+        if (countOk && rateOk) {
+            // Carry the overshoot so the average rate stays on target, but
+            // don't let a long stall turn into a burst of back-to-back renders
+            sinceLastRender_ -= minInterval_;
+            if (sinceLastRender_ > minInterval_) sinceLastRender_ = 0.0;
+            return true;
+        }
+        return false;
+    }
+
+    // Start fresh (next call renders if the limits allow it from zero)
+    void reset() {
+        frames_ = 0;
+        sinceLastRender_ = 0.0;
+    }
+
+private:
+    unsigned everyNth_ = 0;
+    double minInterval_ = 0.1;  // 10 Hz by default
+    uint64_t frames_ = 0;
+    double sinceLastRender_ = 0.0;
+};
+#endif  // RENDER_DECIMATOR_HPP
@@ -0,0 +1,190 @@
+// RenderHandoff.hpp - Pooled Frames from the Main Thread to a Render Thread
+// ============================================================================
+// PURPOSE: Building the UI and submitting + presenting it serialize on one
+// thread: while glfwSwapBuffers() waits for vsync, nothing else happens.
+// With a render thread, the main thread builds frame N+1 while frame N is
+// being drawn and presented.
+//
+//   main thread                          render thread
+//   -----------                          -------------
+//   Frame* f = handoff.acquire();        while (Frame* f = handoff.waitForFrame()) {
+//   ...copy the built frame into *f...       ...submit *f, swap...
+//   handoff.submit(f, id);                   handoff.presented(f);
+//                                        }
+//
+// FRAMES IN FLIGHT: the pool holds framesInFlight frames, each being
+// copied into, queued or presenting. The main thread acquires one only
+// once its UI is built, and acquire() blocks while all are taken, so it
+// runs at most framesInFlight frames ahead of the screen. That's the
+// latency cost: 1 (the default) builds frame N+1 while N is presented,
+// one extra frame of input-to-present latency in exchange for the
+// overlap; more only absorbs uneven frame times.
+//
+// MEASURED: every presented frame comes back through pollPresented() with
+// its submit and present times (Clock seconds, the InputQueue timebase),
+// and acquire() records how long the main thread waited for a free frame.
+//
+// Frames are reused, never reallocated: whatever a Frame keeps (vertex and
+// index buffers) keeps its capacity from one use to the next.
+//
+
+#ifndef RENDER_HANDOFF_HPP
+#define RENDER_HANDOFF_HPP
+#include <algorithm>  // for std::clamp
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "LatencyHistogram.hpp"
+#include "SpscQueue.hpp"
+#include "Timer.hpp"
+
+struct PresentedFrame {
+    uint64_t id = 0;                // As passed to submit()
+    double submittedSeconds = 0.0;  // Clock seconds
+    double presentedSeconds = 0.0;
+};
+
+template <typename Frame, typename Clock = Timer::Clock>
+class RenderHandoff {
+public:
+    static constexpr size_t MAX_FRAMES_IN_FLIGHT = 3;
+
+    static double now() {
+        return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+    }
+
+    explicit RenderHandoff(size_t framesInFlight = 1)
+        : framesInFlight_(std::clamp<size_t>(framesInFlight, 1, MAX_FRAMES_IN_FLIGHT)) {
+        for (size_t i = 0; i < framesInFlight_; ++i) {
+            frames_.push_back(std::make_unique<Slot>());
+            free_.push_back(frames_.back().get());
+        }
+        free_.reserve(frames_.size());
+    }
+
+    // Non-copyable (both threads hold references to it)
+    RenderHandoff(const RenderHandoff&) = delete;
+    RenderHandoff& operator=(const RenderHandoff&) = delete;
+
+    size_t framesInFlight() const { return framesInFlight_; }
+
+    // ========================================================================
+    // Main Thread
+    // ========================================================================
+
+    // A frame to fill, waiting for the render thread to free one if needed.
+    // Null once stop() has been called.
+    Frame* acquire() {
+        double start = now();
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait(lock, [this]() { return stopping_ || !free_.empty(); });
+        acquireWait_.add((now() - start) * 1000.0);
+        if (stopping_) return nullptr;
+        Slot* slot = free_.back();
+        free_.pop_back();
+        return &slot->frame;
+    }
+
+    // Queues a frame from acquire() for the render thread
+    void submit(Frame* frame, uint64_t id) {
+        Slot* slot = slotOf(frame);
+        if (!slot) return;
+        slot->id = id;
+        slot->submittedSeconds = now();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ready_[(readyHead_ + readyCount_++) % ready_.size()] = slot;
+        }
+        changed_.notify_all();
+    }
+
+    // Gives back a frame from acquire() without presenting it
+    void cancel(Frame* frame) {
+        Slot* slot = slotOf(frame);
+        if (!slot) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.push_back(slot);
+        }
+        changed_.notify_all();
+    }
+
+    // Frames the render thread has presented since the last call, oldest first
+    bool pollPresented(PresentedFrame& out) { return presented_.pop(out); }
+
+    // Main-thread time blocked in acquire() (ms): nonzero when the render
+    // thread (or vsync) is the bottleneck
+    const LatencyHistogram& acquireWait() const { return acquireWait_; }
+
+    // Wakes both threads for shutdown: acquire() and waitForFrame() return null
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        changed_.notify_all();
+    }
+
+    // ========================================================================
+    // Render Thread
+    // ========================================================================
+
+    // Oldest submitted frame, blocking until one is queued. Null after stop().
+    Frame* waitForFrame() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait(lock, [this]() { return stopping_ || readyCount_ > 0; });
+        if (stopping_) return nullptr;
+        Slot* slot = ready_[readyHead_];
+        readyHead_ = (readyHead_ + 1) % ready_.size();
+        --readyCount_;
+        return &slot->frame;
+    }
+
+    // Call after the swap: the frame returns to the pool
+    void presented(Frame* frame) {
+        Slot* slot = slotOf(frame);
+        if (!slot) return;
+        presented_.push({slot->id, slot->submittedSeconds, now()});  // Full: main isn't polling; drop
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.push_back(slot);
+        }
+        changed_.notify_all();
+    }
+
+private:
+    struct Slot {
+        Frame frame;
+        uint64_t id = 0;
+        double submittedSeconds = 0.0;
+    };
+
+    // At most MAX_FRAMES_IN_FLIGHT slots: a scan beats any bookkeeping
+    Slot* slotOf(Frame* frame) const {
+        for (const auto& slot : frames_) {
+            if (&slot->frame == frame) return slot.get();
+        }
+        return nullptr;
+    }
+
+    size_t framesInFlight_;
+    std::vector<std::unique_ptr<Slot>> frames_;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<Slot*> free_;
+    std::array<Slot*, MAX_FRAMES_IN_FLIGHT> ready_{};  // FIFO ring, never allocates
+    size_t readyHead_ = 0;
+    size_t readyCount_ = 0;
+    bool stopping_ = false;
+
+    SpscQueue<PresentedFrame, 16> presented_;
+    LatencyHistogram acquireWait_;
+};
+#endif  // RENDER_HANDOFF_HPP
@@ -0,0 +1,215 @@
+// ============================================================================
+// RenderInterpolation.cpp - Scalar / SSE2 / AVX2 Blend Kernels + Dispatch
+// ============================================================================
+//
+// The SIMD kernels live in this one translation unit so the rest of the
+// build needs no per-file ISA flags: on GCC/Clang the AVX2 functions are
+// compiled with __attribute__((target)), on MSVC the intrinsics are always
+// available. Which kernel actually runs is decided once at runtime from
+// CPUID, so the same binary works on CPUs without AVX2.
+//
+// Every kernel handles the full width it can, then finishes the tail with
+// the scalar code — results for the tail are bit-identical to scalar.
+//
+
+#include "RenderInterpolation.hpp"
+
+#include <cmath>  // for std::sqrt
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define RENDER_INTERPOLATION_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>  // for __cpuid, __cpuidex
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define TARGET_AVX2
+#endif
+
+namespace {
+
+// ============================================================================
+// Scalar
+// ============================================================================
+
+void lerpScalarRange(const float* a, const float* b, float* out, size_t begin, size_t end,
+                     float alpha) {
+    for (size_t i = begin; i < end; ++i) out[i] = a[i] + (b[i] - a[i]) * alpha;
+}
+
+void nlerpScalarRange(const float* const a[4], const float* const b[4], float* const out[4],
+                      size_t begin, size_t end, float alpha) {
+    for (size_t i = begin; i < end; ++i) {
+        float dot = a[0][i] * b[0][i] + a[1][i] * b[1][i] + a[2][i] * b[2][i] + a[3][i] * b[3][i];
+        float sign = dot < 0.0f ? -1.0f : 1.0f;  // q and -q are the same rotation
+
+        float q[4];
+        float lengthSq = 0.0f;
+        for (int c = 0; c < 4; ++c) {
+            q[c] = a[c][i] + (b[c][i] * sign - a[c][i]) * alpha;
+            lengthSq += q[c] * q[c];
+        }
+        // Unit inputs on the shorter arc never blend below length ~0.7
+        float invLength = 1.0f / std::sqrt(lengthSq);
+        for (int c = 0; c < 4; ++c) out[c][i] = q[c] * invLength;
+    }
+}
+
+void lerpScalar(const float* a, const float* b, float* out, size_t n, float alpha) {
+    lerpScalarRange(a, b, out, 0, n, alpha);
+}
+
+void nlerpScalar(const float* const a[4], const float* const b[4], float* const out[4], size_t n,
+                 float alpha) {
+    nlerpScalarRange(a, b, out, 0, n, alpha);
+}
+
+constexpr InterpolationKernels SCALAR_KERNELS{lerpScalar, nlerpScalar, SimdLevel::Scalar,
+                                              "scalar"};
+
+#ifdef RENDER_INTERPOLATION_X86
+
+// ============================================================================
+// SSE2 (baseline on x86-64: no target attribute needed)
+// ============================================================================
+
+void lerpSse2(const float* a, const float* b, float* out, size_t n, float alpha) {
+    const __m128 t = _mm_set1_ps(alpha);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 va = _mm_loadu_ps(a + i);
+        __m128 vb = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), t)));
+    }
+    lerpScalarRange(a, b, out, i, n, alpha);
+}
+
+void nlerpSse2(const float* const a[4], const float* const b[4], float* const out[4], size_t n,
+               float alpha) {
+    const __m128 t = _mm_set1_ps(alpha);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 qa[4];
+        __m128 qb[4];
+        __m128 dot = _mm_setzero_ps();
+        for (int c = 0; c < 4; ++c) {
+            qa[c] = _mm_loadu_ps(a[c] + i);
+            qb[c] = _mm_loadu_ps(b[c] + i);
+            dot = _mm_add_ps(dot, _mm_mul_ps(qa[c], qb[c]));
+        }
+        // Flip b where the dot product is negative: xor in its sign bit
+        __m128 flip = _mm_and_ps(dot, signBit);
+
+        __m128 q[4];
+        __m128 lengthSq = _mm_setzero_ps();
+        for (int c = 0; c < 4; ++c) {
+            __m128 vb = _mm_xor_ps(qb[c], flip);
+            q[c] = _mm_add_ps(qa[c], _mm_mul_ps(_mm_sub_ps(vb, qa[c]), t));
+            lengthSq = _mm_add_ps(lengthSq, _mm_mul_ps(q[c], q[c]));
+        }
+        __m128 length = _mm_sqrt_ps(lengthSq);
+        for (int c = 0; c < 4; ++c) _mm_storeu_ps(out[c] + i, _mm_div_ps(q[c], length));
+    }
+    nlerpScalarRange(a, b, out, i, n, alpha);
+}
+
+constexpr InterpolationKernels SSE2_KERNELS{lerpSse2, nlerpSse2, SimdLevel::SSE2, "sse2"};
+
+// ============================================================================
+// AVX2 + FMA
+// ============================================================================
+
+TARGET_AVX2 void lerpAvx2(const float* a, const float* b, float* out, size_t n, float alpha) {
+    const __m256 t = _mm256_set1_ps(alpha);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 va = _mm256_loadu_ps(a + i);
+        __m256 vb = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_sub_ps(vb, va), t, va));
+    }
+    lerpScalarRange(a, b, out, i, n, alpha);
+}
+
+TARGET_AVX2 void nlerpAvx2(const float* const a[4], const float* const b[4], float* const out[4],
+                           size_t n, float alpha) {
+    const __m256 t = _mm256_set1_ps(alpha);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 qa[4];
+        __m256 qb[4];
+        __m256 dot = _mm256_setzero_ps();
+        for (int c = 0; c < 4; ++c) {
+            qa[c] = _mm256_loadu_ps(a[c] + i);
+            qb[c] = _mm256_loadu_ps(b[c] + i);
+            dot = _mm256_fmadd_ps(qa[c], qb[c], dot);
+        }
+        __m256 flip = _mm256_and_ps(dot, signBit);
+
+        __m256 q[4];
+        __m256 lengthSq = _mm256_setzero_ps();
+        for (int c = 0; c < 4; ++c) {
+            __m256 vb = _mm256_xor_ps(qb[c], flip);
+            q[c] = _mm256_fmadd_ps(_mm256_sub_ps(vb, qa[c]), t, qa[c]);
+            lengthSq = _mm256_fmadd_ps(q[c], q[c], lengthSq);
+        }
+        __m256 length = _mm256_sqrt_ps(lengthSq);
+        for (int c = 0; c < 4; ++c) _mm256_storeu_ps(out[c] + i, _mm256_div_ps(q[c], length));
+    }
+    nlerpScalarRange(a, b, out, i, n, alpha);
+}
+
+constexpr InterpolationKernels AVX2_KERNELS{lerpAvx2, nlerpAvx2, SimdLevel::AVX2, "avx2"};
+
+// ============================================================================
+// CPU Detection
+// ============================================================================
+
+bool cpuHasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma) return false;
+    // The OS must save YMM registers on context switch (XCR0 bits 1 and 2)
+    if ((_xgetbv(0) & 0x6) != 0x6) return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+
+#endif  // RENDER_INTERPOLATION_X86
+
+}  // namespace
+
+SimdLevel detectSimdLevel() {
+#ifdef RENDER_INTERPOLATION_X86
+    static const SimdLevel level = cpuHasAvx2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const InterpolationKernels& interpolationKernels(SimdLevel level) {
+#ifdef RENDER_INTERPOLATION_X86
+    if (level == SimdLevel::AVX2 && detectSimdLevel() == SimdLevel::AVX2) return AVX2_KERNELS;
+    if (level != SimdLevel::Scalar) return SSE2_KERNELS;
+#else
+    (void)level;
+#endif
+    return SCALAR_KERNELS;
+}
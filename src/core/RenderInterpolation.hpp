@@ -0,0 +1,139 @@
+// RenderInterpolation.hpp - Double-Buffered Render State + SIMD Blending
+// ============================================================================
+// PURPOSE: The fixed timestep loop leaves an interpolation alpha behind
+// (GameLoop::alpha()). To draw smoothly between ticks, every object's
+// transform is blended between the previous tick and the current tick.
+// With thousands of objects that blend costs more than the tick itself if
+// it's done one object at a time, so:
+//
+// - Transforms are stored structure-of-arrays: one float stream per
+//   component (px, py, pz, qx, qy, qz, qw, sx, sy, sz)
+// - Two copies (previous / current) are kept; beginTick() flips them
+// - Blending runs over whole streams with SSE or AVX2 kernels, picked at
+//   runtime from what the CPU supports, with a scalar fallback
+//
+// Position and scale are lerped. Rotation (unit quaternions) is nlerped:
+// lerp along the shorter arc, then renormalize.
+//
+// Render-side only: FMA in the AVX2 kernel can round differently from the
+// scalar path, so never feed interpolated values back into the simulation.
+//
+
+#ifndef RENDER_INTERPOLATION_HPP
+#define RENDER_INTERPOLATION_HPP
+#include <array>
+#include <cstddef>  // for size_t
+#include <vector>
+
+// ============================================================================
+// Transform Streams (structure-of-arrays)
+// ============================================================================
+
+struct TransformStreams {
+    enum Component { PX, PY, PZ, QX, QY, QZ, QW, SX, SY, SZ, COUNT };
+
+    std::array<std::vector<float>, COUNT> streams;
+
+    void resize(size_t n) {
+        for (std::vector<float>& s : streams) s.resize(n);
+    }
+
+    size_t size() const { return streams[PX].size(); }
+
+    float* operator[](Component c) { return streams[c].data(); }
+    const float* operator[](Component c) const { return streams[c].data(); }
+};
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+enum class SimdLevel { Scalar, SSE2, AVX2 };
+
+struct InterpolationKernels {
+    // out[i] = a[i] + (b[i] - a[i]) * alpha
+    void (*lerp)(const float* a, const float* b, float* out, size_t n, float alpha);
+
+    // Per element: normalize(a + (±b - a) * alpha), sign chosen per element
+    // so the blend takes the shorter arc. Arrays are {x, y, z, w} streams.
+    void (*nlerpQuat)(const float* const a[4], const float* const b[4], float* const out[4],
+                      size_t n, float alpha);
+
+    SimdLevel level;
+    const char* name;
+};
+
+// Best level this CPU supports (cached after the first call)
+SimdLevel detectSimdLevel();
+
+// Kernels for a given level. Asking for a level the CPU or build doesn't
+// support falls back to the best one that is available.
+const InterpolationKernels& interpolationKernels(SimdLevel level);
+
+// Kernels for detectSimdLevel()
+inline const InterpolationKernels& bestInterpolationKernels() {
+    return interpolationKernels(detectSimdLevel());
+}
+
+// ============================================================================
+// RenderStateBuffer
+// ============================================================================
+
+class RenderStateBuffer {
+public:
+    void resize(size_t n) {
+        buffers_[0].resize(n);
+        buffers_[1].resize(n);
+    }
+
+    size_t size() const { return buffers_[0].size(); }
+
+    // ========================================================================
+    // Fixed Update Side
+    // ========================================================================
+    //
+    // Call beginTick() at the start of each fixed update, then write EVERY
+    // entity's transform into current(). The old current becomes previous —
+    // nothing is copied, so an entity that isn't written this tick would
+    // show stale data from two ticks ago.
+    //
+
+    void beginTick() { currentIndex_ ^= 1u; }
+
+    // After writing current(): make previous identical, so the next render
+    // shows this tick as-is (use when rows no longer line up across ticks)
+    void snap() { buffers_[currentIndex_ ^ 1u] = buffers_[currentIndex_]; }
+
+    TransformStreams& current() { return buffers_[currentIndex_]; }
+    const TransformStreams& current() const { return buffers_[currentIndex_]; }
+    const TransformStreams& previous() const { return buffers_[currentIndex_ ^ 1u]; }
+
+    // ========================================================================
+    // Render Side
+    // ========================================================================
+
+    // Blend previous -> current by alpha (0 = previous, 1 = current) into out
+    void interpolate(float alpha, TransformStreams& out,
+                     const InterpolationKernels& kernels = bestInterpolationKernels()) const {
+        const TransformStreams& a = previous();
+        const TransformStreams& b = current();
+        size_t n = size();
+        out.resize(n);
+
+        using C = TransformStreams::Component;
+        for (C c : {C::PX, C::PY, C::PZ, C::SX, C::SY, C::SZ}) {
+            kernels.lerp(a[c], b[c], out[c], n, alpha);
+        }
+
+        const float* qa[4] = {a[C::QX], a[C::QY], a[C::QZ], a[C::QW]};
+        const float* qb[4] = {b[C::QX], b[C::QY], b[C::QZ], b[C::QW]};
+        float* qo[4] = {out[C::QX], out[C::QY], out[C::QZ], out[C::QW]};
+        kernels.nlerpQuat(qa, qb, qo, n, alpha);
+    }
+
+private:
+    std::array<TransformStreams, 2> buffers_;
+    size_t currentIndex_ = 0;
+};
+
+#endif  // RENDER_INTERPOLATION_HPP
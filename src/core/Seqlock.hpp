@@ -0,0 +1,96 @@
+// Seqlock.hpp - Single-Writer / Multi-Reader Versioned Snapshot
+// ============================================================================
+// PURPOSE: Let any number of threads read the latest copy of a small value
+// (timing stats, pause state, time scale) while one thread keeps updating
+// it. Unlike a mutex, readers never block the writer and the writer never
+// waits for readers: store() is a fixed handful of atomic stores.
+//
+// HOW IT WORKS:
+//
+//   A sequence counter is odd while a write is in progress and even when
+//   the value is stable. A reader copies the value between two reads of the
+//   counter; if the counter changed (or was odd), a write overlapped and the
+//   reader simply tries again. Each completed store() bumps the version by 2.
+//
+// The payload is kept as std::atomic<uint64_t> words rather than a plain T,
+// so the (intentionally) overlapping reads are not a data race. Ordering
+// uses release stores / acquire loads on those words instead of fences:
+// correct under the C++ memory model, ThreadSanitizer-clean, and on x86
+// every one of them compiles to a plain mov.
+//
+// Compared to TripleBuffer (one reader, which owns its copy), a Seqlock has
+// any number of readers, each of which gets its own copy on every load().
+//
+
+#ifndef SEQLOCK_HPP
+#define SEQLOCK_HPP
+#include <array>
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <cstring>  // for std::memcpy
+#include <thread>   // for std::this_thread::yield
+#include <type_traits>
+
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "Seqlock copies T with memcpy");
+
+public:
+    explicit Seqlock(const T& initial = T{}) { store(initial); }
+
+    // Non-copyable (readers hold references to it)
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+
+    // ========================================================================
+    // Writer Side (one thread only)
+    // ========================================================================
+
+    void store(const T& value) {
+        std::array<uint64_t, WORDS> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);  // Odd: writing
+        // Release per word: a reader that sees any new word also sees the odd count
+        for (size_t i = 0; i < WORDS; ++i) words_[i].store(words[i], std::memory_order_release);
+        sequence_.store(sequence + 2, std::memory_order_release);  // Even: stable
+    }
+
+    // ========================================================================
+    // Reader Side (any thread, any number)
+    // ========================================================================
+
+    // Latest complete value. Retries while a store() overlaps; the writer
+    // holds the odd count for only a few stores, so this is effectively
+    // never more than one retry.
+    T load() const {
+        T value;
+        while (!tryLoad(value)) std::this_thread::yield();
+        return value;
+    }
+
+    // One attempt: false if a store() overlapped (value left unspecified)
+    bool tryLoad(T& value) const {
+        uint64_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1) return false;
+
+        std::array<uint64_t, WORDS> words;
+        for (size_t i = 0; i < WORDS; ++i) words[i] = words_[i].load(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != before) return false;
+
+        std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+        return true;
+    }
+
+    // Number of completed stores (including the initial value)
+    uint64_t version() const { return sequence_.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> sequence_{0};
+    std::array<std::atomic<uint64_t>, WORDS> words_{};
+};
+#endif  // SEQLOCK_HPP
@@ -0,0 +1,85 @@
+// SpscQueue.hpp - Lock-Free Bounded Single-Producer / Single-Consumer Queue
+// ============================================================================
+// PURPOSE: Pass every item (not just the latest, unlike TripleBuffer) from
+// one thread to another without locks or allocation. The producer never
+// waits: when the queue is full, push() fails and the caller decides what
+// to drop.
+//
+// HOW IT WORKS:
+//
+//   A fixed ring of Capacity slots (a power of two) and two ever-increasing
+//   counters. Only the producer writes head_, only the consumer writes
+//   tail_; each publishes with a release store and reads the other's with
+//   an acquire load, so an item is fully written before it becomes visible.
+//   head_ - tail_ is the number of queued items.
+//
+
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+#include <array>
+#include <atomic>
+#include <cstddef>  // for size_t
+
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    // Non-copyable (both threads hold references to it)
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // ========================================================================
+    // Producer Side (one thread only)
+    // ========================================================================
+
+    // False if full (the item is not queued)
+    bool push(const T& item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == Capacity) return false;
+        slots_[head & MASK] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ========================================================================
+    // Consumer Side (one thread only)
+    // ========================================================================
+
+    // Oldest item without removing it, or nullptr if empty
+    const T* peek() const {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return nullptr;
+        return &slots_[tail & MASK];
+    }
+
+    bool pop(T& out) {
+        const T* front = peek();
+        if (!front) return false;
+        out = *front;
+        discardFront();
+        return true;
+    }
+
+    // Remove the item peek() returned
+    void discardFront() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Approximate when called from the producer (the consumer may be popping)
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    std::array<T, Capacity> slots_{};
+    std::atomic<size_t> head_{0};  // Next slot to write (producer)
+    std::atomic<size_t> tail_{0};  // Next slot to read (consumer)
+};
+#endif  // SPSC_QUEUE_HPP
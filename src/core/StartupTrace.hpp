@@ -0,0 +1,138 @@
+// StartupTrace.hpp - Timed Startup Phases and Time-to-First-Frame
+// ============================================================================
+// PURPOSE: Put numbers on startup. Each phase (GLFW init, window creation,
+// settings parse, font atlas build, ...) is timed with a Scope, from any
+// thread, relative to one origin taken at the top of main(). The first
+// presented frame is marked separately, giving time-to-first-frame.
+//
+// Phases that run concurrently show up with overlapping start/end times on
+// different threads in report(), so it's easy to see which one the first
+// frame actually waited for.
+//
+// Recording takes a mutex: it happens a dozen times per run, never per frame.
+//
+
+#ifndef STARTUP_TRACE_HPP
+#define STARTUP_TRACE_HPP
+#include <fmt/core.h>
+
+#include <algorithm>  // for std::find, std::sort
+#include <cstddef>    // for size_t
+#include <iterator>   // for std::back_inserter
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Timer.hpp"
+
+struct StartupPhase {
+    const char* name = "";  // String literal
+    unsigned thread = 0;    // 0 = the thread that created the trace, then 1, 2, ...
+    double startSeconds = 0.0;
+    double endSeconds = 0.0;
+
+    double seconds() const { return endSeconds - startSeconds; }
+};
+
+class StartupTrace {
+public:
+    StartupTrace() { threads_.push_back(std::this_thread::get_id()); }
+
+    // Non-copyable (Scopes hold a reference)
+    StartupTrace(const StartupTrace&) = delete;
+    StartupTrace& operator=(const StartupTrace&) = delete;
+
+    // ========================================================================
+    // Scope - Times one phase (RAII, like ScopedTimer)
+    // ========================================================================
+
+    class Scope {
+    public:
+        Scope(StartupTrace& trace, const char* name)
+            : trace_(trace), name_(name), start_(trace.now()) {}
+
+        ~Scope() { trace_.record(name_, start_, trace_.now()); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        StartupTrace& trace_;
+        const char* name_;
+        double start_;
+    };
+
+    // Seconds since the trace was created
+    double now() const { return origin_.elapsed(); }
+
+    void record(const char* name, double startSeconds, double endSeconds) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        phases_.push_back({name, threadIndex(), startSeconds, endSeconds});
+    }
+
+    // Call right after the first buffer swap (later calls are ignored)
+    void markFirstFrame() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (firstFrameSeconds_ < 0.0) firstFrameSeconds_ = now();
+    }
+
+    // ========================================================================
+    // Results
+    // ========================================================================
+
+    // Negative until markFirstFrame() has been called
+    double timeToFirstFrame() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return firstFrameSeconds_;
+    }
+
+    // Copy of the recorded phases, sorted by start time
+    std::vector<StartupPhase> phases() const {
+        std::vector<StartupPhase> sorted;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sorted = phases_;
+        }
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const StartupPhase& a, const StartupPhase& b) {
+                      return a.startSeconds < b.startSeconds;
+                  });
+        return sorted;
+    }
+
+    // Human-readable table, one line per phase, plus time-to-first-frame
+    std::string report() const {
+        std::string out = "Startup phases (ms):\n";
+        auto it = std::back_inserter(out);
+        fmt::format_to(it, "  {:<24} {:>6} {:>9} {:>9}\n", "phase", "thread", "start", "took");
+        for (const StartupPhase& phase : phases()) {
+            fmt::format_to(it, "  {:<24} {:>6} {:>9.2f} {:>9.2f}\n", phase.name, phase.thread,
+                           phase.startSeconds * 1000.0, phase.seconds() * 1000.0);
+        }
+        double firstFrame = timeToFirstFrame();
+        if (firstFrame >= 0.0) {
+            fmt::format_to(it, "  Time to first frame: {:.2f} ms\n", firstFrame * 1000.0);
+        }
+        return out;
+    }
+
+private:
+    // Small stable index per thread (caller holds mutex_)
+    unsigned threadIndex() {
+        std::thread::id id = std::this_thread::get_id();
+        auto found = std::find(threads_.begin(), threads_.end(), id);
+        if (found == threads_.end()) {
+            threads_.push_back(id);
+            return static_cast<unsigned>(threads_.size() - 1);
+        }
+        return static_cast<unsigned>(found - threads_.begin());
+    }
+
+    Timer origin_;
+    mutable std::mutex mutex_;
+    std::vector<StartupPhase> phases_;
+    std::vector<std::thread::id> threads_;
+    double firstFrameSeconds_ = -1.0;
+};
+#endif  // STARTUP_TRACE_HPP
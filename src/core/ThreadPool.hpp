@@ -0,0 +1,129 @@
+// ThreadPool.hpp - Fixed-Size Worker Pool with a Blocking parallelFor
+// ============================================================================
+// PURPOSE: Split a loop over N independent items across all cores.
+// - Threads are created once, not per call
+// - Work is handed out in chunks from an atomic counter, so fast threads
+//   pick up the slack from slow ones (no static partition imbalance)
+// - The calling thread works too, then waits for the others to finish
+//
+// Only one parallelFor runs at a time; call it from a single thread.
+//
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+#include <algorithm>  // for std::min, std::max
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    // threads = total threads including the caller (0 = one per core)
+    explicit ThreadPool(unsigned threads = 0) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        workers_.reserve(threads - 1);
+        for (unsigned i = 0; i + 1 < threads; ++i) {
+            workers_.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) worker.join();
+    }
+
+    // Non-copyable (owns threads)
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Total threads that run work, including the caller of parallelFor
+    unsigned size() const { return static_cast<unsigned>(workers_.size()) + 1; }
+
+    // ========================================================================
+    // parallelFor - Run fn(begin, end) over [0, count) in chunks of `grain`
+    // ========================================================================
+    //
+    // Blocks until every chunk has run. fn must be safe to call concurrently
+    // on disjoint ranges.
+    //
+
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn) {
+        if (count == 0) return;
+        grain = std::max<size_t>(grain, 1);
+
+        // Not worth waking anyone for a single chunk
+        if (workers_.empty() || count <= grain) {
+            fn(0, count);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &fn;
+            count_ = count;
+            grain_ = grain;
+            next_.store(0, std::memory_order_relaxed);
+            busy_ = workers_.size();
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        runChunks();
+
+        // Wait for the workers to drain their last chunk
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this]() { return busy_ == 0; });
+        job_ = nullptr;
+    }
+
+private:
+    void runChunks() {
+        const auto& fn = *job_;
+        for (;;) {
+            size_t begin = next_.fetch_add(grain_, std::memory_order_relaxed);
+            if (begin >= count_) break;
+            fn(begin, std::min(count_, begin + grain_));
+        }
+    }
+
+    void workerLoop() {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&]() { return stopping_ || generation_ != seen; });
+                if (stopping_) return;
+                seen = generation_;
+            }
+
+            runChunks();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0) done_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+
+    // Current job (written under mutex_ before waking workers)
+    const std::function<void(size_t, size_t)>* job_ = nullptr;
+    size_t count_ = 0;
+    size_t grain_ = 1;
+    std::atomic<size_t> next_{0};
+    size_t busy_ = 0;
+    uint64_t generation_ = 0;
+    bool stopping_ = false;
+};
+#endif  // THREAD_POOL_HPP
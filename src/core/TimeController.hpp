@@ -69,6 +69,22 @@ class TimeController {
 
     void resetTimeScale() { timeScale_ = 1.0f; }
 
+    // ========================================================================
+    // Turbo (uncapped fast-forward)
+    // ========================================================================
+    //
+    // Time scale is capped at 5x and still bound by the spiral of death cap.
+    // Turbo ignores both: the GameLoop runs fixed updates back-to-back for as
+    // long as the CPU allows, and rendering is decimated so it never throttles
+    // the simulation. Pause and step still work while turbo is on.
+    //
+
+    bool isTurbo() const { return turbo_; }
+
+    void setTurbo(bool enabled) { turbo_ = enabled; }
+
+    void toggleTurbo() { turbo_ = !turbo_; }
+
     // ========================================================================
     // Convenience Methods
     // ========================================================================
@@ -77,11 +93,13 @@ class TimeController {
         paused_ = false;
         stepRequested_ = false;
         timeScale_ = 1.0f;
+        turbo_ = false;
     }
 
    private:
     bool paused_ = false;
     bool stepRequested_ = false;
     float timeScale_ = 1.0f;
+    bool turbo_ = false;
 };
 #endif  // TIME_CONTROLLER_HPP
\ No newline at end of file
@@ -0,0 +1,59 @@
+// TimingStatus.hpp - Loop Timing State, Readable From Any Thread
+// ============================================================================
+// PURPOSE: FrametimeHistory, TimeController and GameLoop are plain objects
+// owned by the frame thread. Anything else (a watchdog, an exporter, a sim
+// thread) reads this flat copy instead, published once per frame through a
+// Seqlock, so it never races with the loop and never slows it down.
+//
+
+#ifndef TIMING_STATUS_HPP
+#define TIMING_STATUS_HPP
+#include <cstdint>  // for uint64_t
+
+#include "FrameTimeHistory.hpp"
+#include "GameLoop.hpp"
+#include "Seqlock.hpp"
+#include "TimeController.hpp"
+
+struct TimingStatus {
+    uint64_t frame = 0;
+    uint64_t tick = 0;
+
+    // Frame times (milliseconds) over FrametimeHistory's raw window
+    float frameMs = 0.0f;
+    float averageMs = 0.0f;
+    float medianMs = 0.0f;
+    float minimumMs = 0.0f;
+    float maximumMs = 0.0f;
+
+    // Loop / TimeController state
+    double alpha = 0.0;
+    double droppedSeconds = 0.0;
+    double speedMultiplier = 1.0;
+    float timeScale = 1.0f;
+    bool paused = false;
+    bool turbo = false;
+};
+
+using TimingStatusPublisher = Seqlock<TimingStatus>;
+
+// Gather the current state (frame thread only)
+inline TimingStatus captureTimingStatus(uint64_t frame, float frameMs, const FrametimeHistory& history,
+                                        const TimeController& time, const GameLoop& loop) {
+    TimingStatus status;
+    status.frame = frame;
+    status.tick = loop.tick();
+    status.frameMs = frameMs;
+    status.averageMs = history.average();
+    status.medianMs = history.median();
+    status.minimumMs = history.minimum();
+    status.maximumMs = history.maximum();
+    status.alpha = loop.alpha();
+    status.droppedSeconds = loop.droppedTime();
+    status.speedMultiplier = loop.speedMultiplier();
+    status.timeScale = time.getTimeScale();
+    status.paused = time.isPaused();
+    status.turbo = time.isTurbo();
+    return status;
+}
+#endif  // TIMING_STATUS_HPP
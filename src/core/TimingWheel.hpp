@@ -0,0 +1,253 @@
+// TimingWheel.hpp - Hierarchical Timing Wheel for Simulation-Time Timers
+// ============================================================================
+// PURPOSE: Schedule callbacks (cooldowns, timeouts, delayed events) a number
+// of fixed ticks in the future, with:
+// - O(1) schedule and cancel
+// - Amortized O(1) expiry work per tick
+// - No per-tick scan of pending timers, no sorted container
+//
+// The wheel has no notion of wall time. It only moves when advance() is
+// called, which the GameLoop does once per fixed update — so timers freeze
+// while TimeController is paused, fire on a single step(), and fire once per
+// tick when several ticks run in one frame.
+//
+
+#ifndef TIMING_WHEEL_HPP
+#define TIMING_WHEEL_HPP
+#include <array>
+#include <bit>         // for std::bit_width
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t, uint64_t
+#include <functional>  // for std::function
+#include <utility>     // for std::move
+#include <vector>
+
+// ============================================================================
+// Timer Handle
+// Returned by schedule(), used to cancel. Stays safe to use after the timer
+// fired or was cancelled (the generation no longer matches).
+// ============================================================================
+
+struct TimerHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+};
+
+class TimingWheel {
+public:
+    using Callback = std::function<void()>;
+
+    // ========================================================================
+    // Wheel Geometry
+    // ========================================================================
+    //
+    // Level 0 has one slot per tick. Each level above it has slots that are
+    // 64x wider than the level below. 11 levels of 6 bits cover all 64 bits
+    // of the tick counter, so no delay ever overflows the wheel.
+    //
+    //   Level 0: ticks   now+1 .. now+63          (exact)
+    //   Level 1: ticks   up to 64^2 away          (64-tick slots)
+    //   Level 2: ticks   up to 64^3 away          (4096-tick slots)
+    //   ...
+    //
+    // When level 0 wraps, the next level-1 slot is "cascaded": its timers
+    // are re-inserted and drop into exact level-0 slots. Each timer cascades
+    // at most once per level, which is where the amortized O(1) comes from.
+    //
+
+    static constexpr unsigned BITS = 6;
+    static constexpr size_t SLOTS = size_t{1} << BITS;  // 64
+    static constexpr uint64_t MASK = SLOTS - 1;
+    static constexpr unsigned LEVELS = (64 + BITS - 1) / BITS;  // 11
+
+    // ========================================================================
+    // Scheduling
+    // ========================================================================
+
+    // Fire `callback` after `delayTicks` more calls to advance().
+    // A delay of 0 is treated as 1 (the earliest a timer can fire is the
+    // next tick; it can never fire "in the past").
+    TimerHandle schedule(uint64_t delayTicks, Callback callback) {
+        return scheduleAt(now_ + (delayTicks == 0 ? 1 : delayTicks), std::move(callback));
+    }
+
+    // Fire `callback` when now() reaches `tick`
+    TimerHandle scheduleAt(uint64_t tick, Callback callback) {
+        if (tick <= now_) tick = now_ + 1;
+
+        uint32_t index = allocate();
+        Node& node = nodes_[index];
+        node.expiry = tick;
+        node.callback = std::move(callback);
+        link(index);
+        ++size_;
+        return {index, node.generation};
+    }
+
+    // Returns false if the timer already fired or was already cancelled
+    bool cancel(TimerHandle handle) {
+        if (!isPending(handle)) return false;
+        unlink(handle.index);
+        release(handle.index);
+        --size_;
+        return true;
+    }
+
+    bool isPending(TimerHandle handle) const {
+        return handle.index < nodes_.size() &&
+               nodes_[handle.index].generation == handle.generation &&
+               nodes_[handle.index].slot != NONE;
+    }
+
+    // ========================================================================
+    // Advance - Called Once Per Fixed Update
+    // ========================================================================
+    //
+    // HOW IT WORKS:
+    // 1. now_ moves forward by one tick
+    // 2. For every level whose lower bits just wrapped to zero, cascade the
+    //    slot we just entered down into finer levels (highest level first)
+    // 3. Every timer in the current level-0 slot expires exactly now; fire them
+    //
+    // Callbacks may schedule or cancel other timers. New timers always land
+    // in a later slot, so the slot being fired can't grow while we drain it.
+    // Returns the number of timers fired.
+    //
+
+    size_t advance() {
+        ++now_;
+
+        unsigned top = 0;
+        while (top + 1 < LEVELS && (now_ & ((uint64_t{1} << (BITS * (top + 1))) - 1)) == 0) {
+            ++top;
+        }
+        for (unsigned level = top; level > 0; --level) {
+            size_t slot = slotIndex(level, now_);
+            while (heads_[slot] != NONE) {
+                uint32_t index = heads_[slot];
+                unlink(index);
+                link(index);  // Lands in a finer level now that now_ is closer
+            }
+        }
+
+        size_t fired = 0;
+        size_t slot = slotIndex(0, now_);
+        while (heads_[slot] != NONE) {
+            uint32_t index = heads_[slot];
+            unlink(index);
+            Callback callback = std::move(nodes_[index].callback);
+            release(index);
+            --size_;
+            ++fired;
+            if (callback) callback();
+        }
+        return fired;
+    }
+
+    // ========================================================================
+    // Getters
+    // ========================================================================
+
+    // Current tick (number of advance() calls so far)
+    uint64_t now() const { return now_; }
+
+    // Number of pending timers
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // Drop every pending timer without firing it. now() is kept.
+    void clear() {
+        for (uint32_t i = 0; i < nodes_.size(); ++i) {
+            if (nodes_[i].slot != NONE) {
+                unlink(i);
+                release(i);
+            }
+        }
+        size_ = 0;
+    }
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    // Intrusive doubly-linked list node. Nodes live in one vector and are
+    // recycled through a free list, so scheduling doesn't allocate once the
+    // pool has grown to the peak number of pending timers.
+    struct Node {
+        uint64_t expiry = 0;
+        Callback callback;
+        uint32_t prev = NONE;
+        uint32_t next = NONE;        // Also the free-list link when unused
+        uint32_t slot = NONE;        // Which heads_ entry owns us (NONE = free)
+        uint32_t generation = 0;     // Bumped on release; invalidates old handles
+    };
+
+    static size_t slotIndex(unsigned level, uint64_t tick) {
+        return level * SLOTS + static_cast<size_t>((tick >> (BITS * level)) & MASK);
+    }
+
+    // Pick the level from the highest bit where expiry and now differ:
+    // the closer the expiry, the finer the level
+    size_t slotFor(uint64_t expiry) const {
+        uint64_t diff = expiry ^ now_;
+        unsigned level = diff == 0 ? 0 : static_cast<unsigned>(std::bit_width(diff) - 1) / BITS;
+        return slotIndex(level, expiry);
+    }
+
+    // Append to the tail of its slot so equal-expiry timers scheduled at the
+    // same level fire in scheduling order
+    void link(uint32_t index) {
+        Node& node = nodes_[index];
+        size_t slot = slotFor(node.expiry);
+        node.slot = static_cast<uint32_t>(slot);
+        node.next = NONE;
+        node.prev = tails_[slot];
+        if (tails_[slot] != NONE) {
+            nodes_[tails_[slot]].next = index;
+        } else {
+            heads_[slot] = index;
+        }
+        tails_[slot] = index;
+    }
+
+    void unlink(uint32_t index) {
+        Node& node = nodes_[index];
+        if (node.prev != NONE) nodes_[node.prev].next = node.next;
+        else heads_[node.slot] = node.next;
+        if (node.next != NONE) nodes_[node.next].prev = node.prev;
+        else tails_[node.slot] = node.prev;
+        node.prev = node.next = NONE;
+    }
+
+    uint32_t allocate() {
+        if (freeHead_ != NONE) {
+            uint32_t index = freeHead_;
+            freeHead_ = nodes_[index].next;
+            return index;
+        }
+        nodes_.emplace_back();
+        return static_cast<uint32_t>(nodes_.size() - 1);
+    }
+
+    void release(uint32_t index) {
+        Node& node = nodes_[index];
+        node.callback = nullptr;
+        node.slot = NONE;
+        ++node.generation;
+        node.next = freeHead_;
+        freeHead_ = index;
+    }
+
+    static constexpr std::array<uint32_t, LEVELS * SLOTS> emptySlots() {
+        std::array<uint32_t, LEVELS * SLOTS> slots{};
+        slots.fill(NONE);
+        return slots;
+    }
+
+    std::array<uint32_t, LEVELS * SLOTS> heads_ = emptySlots();
+    std::array<uint32_t, LEVELS * SLOTS> tails_ = emptySlots();
+    std::vector<Node> nodes_;
+    uint32_t freeHead_ = NONE;
+    uint64_t now_ = 0;
+    size_t size_ = 0;
+};
+#endif  // TIMING_WHEEL_HPP
@@ -0,0 +1,69 @@
+// TripleBuffer.hpp - Lock-Free Single-Writer / Single-Reader Handoff
+// ============================================================================
+// PURPOSE: Hand the latest copy of a value from one thread to another without
+// either side ever blocking. The writer (the frame loop) always has a buffer
+// to write into; the reader (e.g. the metrics server) always has a complete,
+// consistent buffer to read from. Intermediate values may be skipped — the
+// reader only ever sees the most recent publish.
+//
+// HOW IT WORKS:
+//
+//   Writer owns one buffer, reader owns one buffer, the third is "in the
+//   middle". publish() swaps the writer's buffer with the middle one and sets
+//   a DIRTY flag; acquire() swaps the reader's buffer with the middle one if
+//   DIRTY is set. Both swaps are a single atomic exchange.
+//
+
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class TripleBuffer {
+public:
+    // ========================================================================
+    // Writer Side (one thread only)
+    // ========================================================================
+
+    // Fill this in, then call publish()
+    T& writeBuffer() { return buffers_[writeIndex_]; }
+
+    void publish() {
+        uint8_t previous = middle_.exchange(static_cast<uint8_t>(writeIndex_ | DIRTY),
+                                            std::memory_order_acq_rel);
+        writeIndex_ = previous & INDEX;
+    }
+
+    // Convenience: copy a value in and publish it
+    void publish(const T& value) {
+        writeBuffer() = value;
+        publish();
+    }
+
+    // ========================================================================
+    // Reader Side (one thread only)
+    // ========================================================================
+
+    // Grab the newest published value if there is one.
+    // Returns false if nothing new was published since the last acquire().
+    bool acquire() {
+        if ((middle_.load(std::memory_order_relaxed) & DIRTY) == 0) return false;
+        uint8_t previous = middle_.exchange(readIndex_, std::memory_order_acq_rel);
+        readIndex_ = previous & INDEX;
+        return true;
+    }
+
+    const T& readBuffer() const { return buffers_[readIndex_]; }
+
+private:
+    static constexpr uint8_t INDEX = 0b011;
+    static constexpr uint8_t DIRTY = 0b100;
+
+    std::array<T, 3> buffers_{};
+    uint8_t writeIndex_ = 0;          // Writer's private slot
+    std::atomic<uint8_t> middle_{1};  // Shared slot + DIRTY flag
+    uint8_t readIndex_ = 2;           // Reader's private slot
+};
+#endif  // TRIPLE_BUFFER_HPP
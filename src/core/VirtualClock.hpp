@@ -0,0 +1,51 @@
+// VirtualClock.hpp - Manually Advanced Clock for Tests
+// ============================================================================
+// PURPOSE: A std::chrono-compatible clock that only moves when told to.
+// Plug it into BasicTimer / BasicGameLoop and a test can run hours of
+// "wall time" — frame spikes, clock stalls, long pauses — in milliseconds,
+// with exact, repeatable frame times and no sleeping.
+//
+//   using VirtualTimer = BasicTimer<VirtualClock>;
+//   VirtualClock::reset();
+//   VirtualTimer frameTimer;
+//   VirtualClock::advance(std::chrono::milliseconds(16));
+//   loop.advance(frameTimer.lap(), update);   // exactly 0.016
+//
+// Like a real clock, now() is static, so the time is process-wide: call
+// reset() at the start of each test. The counter is atomic, so a clock can
+// be advanced from one thread and read from another.
+//
+
+#ifndef VIRTUAL_CLOCK_HPP
+#define VIRTUAL_CLOCK_HPP
+#include <atomic>
+#include <chrono>
+#include <cstdint>  // for int64_t
+
+struct VirtualClock {
+    using rep = int64_t;
+    using period = std::nano;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<VirtualClock>;
+    static constexpr bool is_steady = true;  // Only ever moves forward
+
+    static time_point now() { return time_point(duration(nanoseconds_.load(std::memory_order_acquire))); }
+
+    // Move time forward (negative durations are ignored: the clock is steady)
+    template <typename Rep, typename Period>
+    static void advance(std::chrono::duration<Rep, Period> step) {
+        rep nanoseconds = std::chrono::duration_cast<duration>(step).count();
+        if (nanoseconds > 0) nanoseconds_.fetch_add(nanoseconds, std::memory_order_acq_rel);
+    }
+
+    static void advanceSeconds(double seconds) {
+        advance(std::chrono::duration<double>(seconds));
+    }
+
+    // Back to time zero
+    static void reset() { nanoseconds_.store(0, std::memory_order_release); }
+
+private:
+    static inline std::atomic<rep> nanoseconds_{0};
+};
+#endif  // VIRTUAL_CLOCK_HPP
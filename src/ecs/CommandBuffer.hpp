@@ -0,0 +1,106 @@
+// CommandBuffer.hpp - Deferred Structural Changes for the World
+// ============================================================================
+// PURPOSE: Systems iterate chunks; creating, destroying or changing an
+// entity's component set moves rows and would pull the arrays out from
+// under the loop. So a system records those changes here and the loop
+// applies them all at once, between fixed ticks:
+//
+//   world.each<Health>([&](Entity e, Health& h) {
+//       if (h.value <= 0) commands.destroy(e);
+//   });
+//   ...
+//   commands.apply(world);  // After the tick
+//
+// create() hands back a real handle immediately (reserved in the World,
+// invisible to queries until applied), so later commands in the same
+// buffer can add components to it. Commands apply in recording order;
+// ones aimed at an entity destroyed in the meantime are skipped.
+//
+// Payloads live in one byte vector that keeps its capacity across ticks,
+// so a steady stream of commands doesn't allocate.
+//
+
+#ifndef ECS_COMMAND_BUFFER_HPP
+#define ECS_COMMAND_BUFFER_HPP
+#include <cstddef>  // for size_t, std::byte
+#include <cstdint>  // for uint8_t
+#include <cstring>  // for std::memcpy
+#include <vector>
+
+#include "World.hpp"
+
+class CommandBuffer {
+public:
+    // A handle that becomes alive (with no components) on apply()
+    Entity create(World& world) {
+        Entity entity = world.reserve();
+        commands_.push_back({Op::Create, entity, 0, 0});
+        return entity;
+    }
+
+    void destroy(Entity entity) { commands_.push_back({Op::Destroy, entity, 0, 0}); }
+
+    template <typename T>
+    void add(Entity entity, const T& value) {
+        size_t offset = payload_.size();
+        payload_.resize(offset + sizeof(T));
+        std::memcpy(payload_.data() + offset, &value, sizeof(T));
+        commands_.push_back({Op::Add, entity, componentId<T>(), offset});
+    }
+
+    template <typename T>
+    void remove(Entity entity) {
+        commands_.push_back({Op::Remove, entity, componentId<T>(), 0});
+    }
+
+    size_t size() const { return commands_.size(); }
+    bool empty() const { return commands_.empty(); }
+
+    // Runs every command in order, then clears the buffer
+    void apply(World& world) {
+        for (const Command& command : commands_) {
+            switch (command.op) {
+                case Op::Create:
+                    world.place(command.entity);
+                    break;
+                case Op::Destroy:
+                    world.destroy(command.entity);  // No-op if already gone
+                    break;
+                case Op::Add:
+                    world.addRaw(command.entity, command.component, payload_.data() + command.offset);
+                    break;
+                case Op::Remove:
+                    world.removeRaw(command.entity, command.component);
+                    break;
+            }
+        }
+        clear();
+    }
+
+    // Drops everything recorded, handing reserved handles back to the World
+    void discard(World& world) {
+        for (const Command& command : commands_) {
+            if (command.op == Op::Create) world.release(command.entity);
+        }
+        clear();
+    }
+
+private:
+    void clear() {
+        commands_.clear();
+        payload_.clear();
+    }
+
+    enum class Op : uint8_t { Create, Destroy, Add, Remove };
+
+    struct Command {
+        Op op;
+        Entity entity;
+        ComponentId component;
+        size_t offset;  // Into payload_ (Add only)
+    };
+
+    std::vector<Command> commands_;
+    std::vector<std::byte> payload_;
+};
+#endif  // ECS_COMMAND_BUFFER_HPP
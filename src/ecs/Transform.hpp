@@ -0,0 +1,73 @@
+// Transform.hpp - Entity Transform Component and Its Render-State Feed
+// ============================================================================
+// PURPOSE: Connect the entity store to render interpolation. Entities with
+// a Transform are what the renderer draws:
+//
+// - After every fixed tick, TransformPublisher::publish() writes each
+//   Transform into RenderStateBuffer::current() (core/RenderInterpolation.hpp)
+// - At render time the buffer blends previous -> current by the loop's
+//   alpha, so motion stays smooth at any ratio of frame rate to tick rate
+//
+// Buffer rows are matched by position, not by entity. When the set or order
+// of transformed entities changes (create, destroy, an archetype move), the
+// tick is written to previous as well: everything snaps for one frame
+// instead of blending one entity's transform into another's.
+//
+
+#ifndef ECS_TRANSFORM_HPP
+#define ECS_TRANSFORM_HPP
+#include <array>
+#include <cstddef>  // for size_t
+#include <vector>
+
+#include "../core/RenderInterpolation.hpp"
+#include "World.hpp"
+
+struct Transform {
+    std::array<float, 3> position = {0.0f, 0.0f, 0.0f};
+    std::array<float, 4> rotation = {0.0f, 0.0f, 0.0f, 1.0f};  // Unit quaternion x, y, z, w
+    std::array<float, 3> scale = {1.0f, 1.0f, 1.0f};
+};
+
+class TransformPublisher {
+public:
+    // Call once per fixed tick, after the tick's commands are applied
+    void publish(World& world, RenderStateBuffer& buffer) {
+        size_t count = 0;
+        world.forEachChunk<const Transform>([&count](size_t n, const Transform*) { count += n; });
+
+        buffer.beginTick();
+        if (buffer.size() != count) buffer.resize(count);
+        rows_.swap(previousRows_);
+        rows_.clear();
+
+        using C = TransformStreams::Component;
+        TransformStreams& out = buffer.current();
+        size_t i = 0;
+        world.each<const Transform>([&](Entity entity, const Transform& t) {
+            rows_.push_back(entity);
+            out[C::PX][i] = t.position[0];
+            out[C::PY][i] = t.position[1];
+            out[C::PZ][i] = t.position[2];
+            out[C::QX][i] = t.rotation[0];
+            out[C::QY][i] = t.rotation[1];
+            out[C::QZ][i] = t.rotation[2];
+            out[C::QW][i] = t.rotation[3];
+            out[C::SX][i] = t.scale[0];
+            out[C::SY][i] = t.scale[1];
+            out[C::SZ][i] = t.scale[2];
+            ++i;
+        });
+
+        if (rows_ != previousRows_) buffer.snap();
+    }
+
+    // Which entity each buffer row holds (valid until the next publish())
+    const std::vector<Entity>& rows() const { return rows_; }
+
+private:
+    std::vector<Entity> rows_;
+    std::vector<Entity> previousRows_;
+};
+
+#endif  // ECS_TRANSFORM_HPP
@@ -0,0 +1,545 @@
+// World.hpp - Archetype-Based Entity Store (SoA, 16 KiB Chunks)
+// ============================================================================
+// PURPOSE: A home for simulation state that the fixed update can stream
+// through at memory bandwidth:
+//
+// - Every distinct SET of components is an archetype. Entities with the
+//   same set live together, in chunks of 16 KiB.
+// - Inside a chunk each component is its own contiguous array (SoA), so a
+//   query touching Position and Velocity reads exactly those bytes, in
+//   order, and the inner loop auto-vectorizes.
+// - Rows are kept dense: destroying an entity moves the archetype's last
+//   row into the hole. Adding/removing a component moves the entity to the
+//   neighbouring archetype (the edge is cached, so it's one lookup).
+//
+//   World world;
+//   Entity e = world.create(Position{0, 0}, Velocity{1, 0});
+//   world.forEachChunk<Position, const Velocity>(
+//       [dt](size_t n, Position* p, const Velocity* v) {
+//           for (size_t i = 0; i < n; ++i) { p[i].x += v[i].x * dt; ... }
+//       });
+//
+// STRUCTURAL CHANGES (create / destroy / add / remove) invalidate chunk
+// pointers, so they must not happen inside a query. Systems record them in
+// a CommandBuffer (CommandBuffer.hpp), which is applied between ticks.
+//
+// Components must be trivially copyable: rows are moved with memcpy, and
+// the whole world can be read as flat byte ranges (forEachByteRange) for
+// hashing, snapshots and interpolation.
+//
+
+#ifndef ECS_WORLD_HPP
+#define ECS_WORLD_HPP
+#include <algorithm>  // for std::max
+#include <array>
+#include <atomic>
+#include <cstddef>  // for size_t, std::byte
+#include <cstdint>  // for uint32_t, uint64_t
+#include <cstring>  // for std::memcpy
+#include <exception>  // for std::terminate
+#include <memory>
+#include <mutex>
+#include <new>  // for std::align_val_t
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "../core/StateHash.hpp"
+
+// ============================================================================
+// Component Types
+// ============================================================================
+
+using ComponentId = uint32_t;
+using ComponentMask = uint64_t;  // Bit per ComponentId
+
+inline constexpr size_t MAX_COMPONENTS = 64;
+
+struct ComponentInfo {
+    size_t size = 0;
+    size_t align = 0;
+};
+
+namespace ecs_detail {
+
+// Process-wide table, filled the first time each type is used. Fixed size,
+// so reading an entry never races with another type registering.
+struct ComponentTable {
+    std::array<ComponentInfo, MAX_COMPONENTS> infos{};
+    std::atomic<uint32_t> count{0};
+    std::mutex mutex;
+};
+
+inline ComponentTable& componentTable() {
+    static ComponentTable table;
+    return table;
+}
+
+inline ComponentId registerComponent(size_t size, size_t align) {
+    ComponentTable& table = componentTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    uint32_t id = table.count.load(std::memory_order_relaxed);
+    if (id >= MAX_COMPONENTS) std::terminate();  // Raise MAX_COMPONENTS (and the mask width)
+    table.infos[id] = {size, align};
+    table.count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+template <typename Component>
+ComponentId registeredId() {
+    static_assert(std::is_trivially_copyable_v<Component>, "components are moved with memcpy");
+    static const ComponentId id = registerComponent(sizeof(Component), alignof(Component));
+    return id;
+}
+
+}  // namespace ecs_detail
+
+// Same id for T, const T and T& (queries name read-only columns as const T)
+template <typename T>
+ComponentId componentId() {
+    return ecs_detail::registeredId<std::remove_cvref_t<T>>();
+}
+
+inline const ComponentInfo& componentInfo(ComponentId id) {
+    return ecs_detail::componentTable().infos[id];
+}
+
+template <typename... Ts>
+ComponentMask componentMask() {
+    return (ComponentMask{0} | ... | (ComponentMask{1} << componentId<Ts>()));
+}
+
+// ============================================================================
+// Entity Handle
+// ============================================================================
+
+struct Entity {
+    static constexpr uint32_t INVALID = 0xFFFFFFFFu;
+
+    uint32_t index = INVALID;
+    uint32_t generation = 0;  // Bumped when the index is reused
+
+    bool valid() const { return index != INVALID; }
+    bool operator==(const Entity&) const = default;
+};
+
+// ============================================================================
+// Archetype - One Component Set, Stored in Chunks
+// ============================================================================
+
+class Archetype {
+public:
+    static constexpr size_t CHUNK_BYTES = 16 * 1024;
+    static constexpr size_t COLUMN_ALIGN = 64;  // Cache line: each array starts on its own
+    static constexpr uint8_t NO_COLUMN = 0xFF;
+
+    struct Column {
+        ComponentId id;
+        size_t size;    // Bytes per entity
+        size_t offset;  // Start of this component's array within a chunk
+    };
+
+    struct Chunk {
+        struct Free {
+            void operator()(std::byte* p) const { ::operator delete(p, std::align_val_t{COLUMN_ALIGN}); }
+        };
+        std::unique_ptr<std::byte, Free> data;
+        size_t count = 0;
+
+        Entity* entities() { return reinterpret_cast<Entity*>(data.get()); }
+        const Entity* entities() const { return reinterpret_cast<const Entity*>(data.get()); }
+    };
+
+    explicit Archetype(ComponentMask mask) : mask_(mask) {
+        slots_.fill(NO_COLUMN);
+        size_t bytesPerEntity = sizeof(Entity);
+        for (ComponentId id = 0; id < MAX_COMPONENTS; ++id) {
+            if (!(mask & (ComponentMask{1} << id))) continue;
+            slots_[id] = static_cast<uint8_t>(columns_.size());
+            columns_.push_back({id, componentInfo(id).size, 0});
+            bytesPerEntity += componentInfo(id).size;
+        }
+
+        // As many rows as fit once every array is padded to a cache line
+        size_t padding = (columns_.size() + 1) * COLUMN_ALIGN;
+        capacity_ = std::max<size_t>(1, (CHUNK_BYTES - padding) / bytesPerEntity);
+        size_t offset = alignUp(capacity_ * sizeof(Entity));
+        for (Column& column : columns_) {
+            column.offset = offset;
+            offset = alignUp(offset + capacity_ * column.size);
+        }
+        chunkBytes_ = std::max(offset, CHUNK_BYTES);  // Only exceeds 16 KiB for huge components
+    }
+
+    ComponentMask mask() const { return mask_; }
+    size_t capacity() const { return capacity_; }  // Rows per chunk
+    size_t size() const { return size_; }          // Rows in use, all chunks
+    size_t chunkCount() const { return chunks_.size(); }
+    Chunk& chunk(size_t i) { return chunks_[i]; }
+    const Chunk& chunk(size_t i) const { return chunks_[i]; }
+    const std::vector<Column>& columns() const { return columns_; }
+
+    bool has(ComponentId id) const { return slots_[id] != NO_COLUMN; }
+
+    // Start of component `id`'s array in a chunk (must be in this archetype)
+    std::byte* column(Chunk& chunk, ComponentId id) {
+        return chunk.data.get() + columns_[slots_[id]].offset;
+    }
+    const std::byte* column(const Chunk& chunk, ComponentId id) const {
+        return chunk.data.get() + columns_[slots_[id]].offset;
+    }
+
+    // Cached neighbours: the archetype with `id` added / removed
+    std::array<uint32_t, MAX_COMPONENTS>& addEdges() { return addEdges_; }
+    std::array<uint32_t, MAX_COMPONENTS>& removeEdges() { return removeEdges_; }
+
+    // ========================================================================
+    // Rows (World keeps entity records in sync)
+    // ========================================================================
+
+    struct Row {
+        uint32_t chunk;
+        uint32_t row;
+    };
+
+    // Appends an uninitialized row for `entity`
+    Row pushRow(Entity entity) {
+        if (chunks_.empty() || chunks_.back().count == capacity_) {
+            Chunk chunk;
+            chunk.data.reset(static_cast<std::byte*>(
+                ::operator new(chunkBytes_, std::align_val_t{COLUMN_ALIGN})));
+            chunks_.push_back(std::move(chunk));
+        }
+        Chunk& chunk = chunks_.back();
+        chunk.entities()[chunk.count] = entity;
+        ++size_;
+        return {static_cast<uint32_t>(chunks_.size() - 1), static_cast<uint32_t>(chunk.count++)};
+    }
+
+    // Fills the hole at `row` with the last row. Returns the entity that
+    // moved into it (invalid if the removed row was the last one).
+    Entity eraseRow(Row row) {
+        Chunk& last = chunks_.back();
+        size_t lastRow = last.count - 1;
+        Chunk& target = chunks_[row.chunk];
+        Entity moved;
+        if (&target != &last || row.row != lastRow) {
+            moved = last.entities()[lastRow];
+            target.entities()[row.row] = moved;
+            for (const Column& column : columns_) {
+                std::memcpy(target.data.get() + column.offset + row.row * column.size,
+                            last.data.get() + column.offset + lastRow * column.size, column.size);
+            }
+        }
+        --size_;
+        if (--last.count == 0) chunks_.pop_back();
+        return moved;
+    }
+
+    std::byte* component(Row row, ComponentId id) {
+        return column(chunks_[row.chunk], id) + row.row * columns_[slots_[id]].size;
+    }
+
+private:
+    static size_t alignUp(size_t value) { return (value + COLUMN_ALIGN - 1) & ~(COLUMN_ALIGN - 1); }
+
+    ComponentMask mask_;
+    std::vector<Column> columns_;
+    std::array<uint8_t, MAX_COMPONENTS> slots_{};  // ComponentId -> index in columns_
+    size_t capacity_ = 0;
+    size_t chunkBytes_ = CHUNK_BYTES;
+    size_t size_ = 0;
+    std::vector<Chunk> chunks_;
+    std::array<uint32_t, MAX_COMPONENTS> addEdges_ = filledEdges();
+    std::array<uint32_t, MAX_COMPONENTS> removeEdges_ = filledEdges();
+
+    static std::array<uint32_t, MAX_COMPONENTS> filledEdges() {
+        std::array<uint32_t, MAX_COMPONENTS> edges;
+        edges.fill(Entity::INVALID);
+        return edges;
+    }
+};
+
+// ============================================================================
+// World
+// ============================================================================
+
+class World {
+public:
+    // Tag passed to forEachByteRange for the entity handle arrays
+    static constexpr ComponentId ENTITY_COLUMN = 0xFFFFFFFFu;
+
+    World() { archetypeFor(0); }  // Archetype 0: no components
+
+    // Non-copyable (chunks are large; copy state through byte ranges)
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // ========================================================================
+    // Entities
+    // ========================================================================
+
+    Entity create() {
+        Entity entity = reserve();
+        place(entity);
+        return entity;
+    }
+
+    template <typename... Ts>
+    Entity create(const Ts&... components) {
+        Entity entity = reserve();
+        Archetype& archetype = *archetypes_[placeIn(entity, archetypeFor(componentMask<Ts...>()))];
+        const Record& record = records_[entity.index];
+        (std::memcpy(archetype.component({record.chunk, record.row}, componentId<Ts>()), &components,
+                     sizeof(Ts)),
+         ...);
+        return entity;
+    }
+
+    void destroy(Entity entity) {
+        if (!alive(entity)) return;
+        Record& record = records_[entity.index];
+        detach(record);
+        record.archetype = Entity::INVALID;
+        ++record.generation;
+        freeIndices_.push_back(entity.index);
+        --alive_;
+    }
+
+    bool alive(Entity entity) const {
+        return entity.index < records_.size() && records_[entity.index].generation == entity.generation &&
+               records_[entity.index].archetype != Entity::INVALID;
+    }
+
+    size_t size() const { return alive_; }
+
+    // ========================================================================
+    // Components
+    // ========================================================================
+
+    // Adds the component, or overwrites it if the entity already has one
+    template <typename T>
+    void add(Entity entity, const T& value) {
+        addRaw(entity, componentId<T>(), &value);
+    }
+
+    template <typename T>
+    void remove(Entity entity) {
+        removeRaw(entity, componentId<T>());
+    }
+
+    template <typename T>
+    bool has(Entity entity) const {
+        return alive(entity) && archetypes_[records_[entity.index].archetype]->has(componentId<T>());
+    }
+
+    // Null if dead or missing. Valid until the next structural change.
+    template <typename T>
+    T* get(Entity entity) {
+        ComponentId id = componentId<T>();
+        if (!alive(entity)) return nullptr;
+        Record& record = records_[entity.index];
+        Archetype& archetype = *archetypes_[record.archetype];
+        if (!archetype.has(id)) return nullptr;
+        return reinterpret_cast<T*>(archetype.component({record.chunk, record.row}, id));
+    }
+
+    // ========================================================================
+    // Queries (no structural changes inside: use a CommandBuffer)
+    // ========================================================================
+
+    // fn(count, Ts*...) once per chunk of every archetype that has all of
+    // Ts — the fast path: plain arrays, one loop per chunk
+    template <typename... Ts, typename Fn>
+    void forEachChunk(Fn&& fn) {
+        ComponentMask required = componentMask<Ts...>();
+        for (auto& archetype : archetypes_) {
+            if ((archetype->mask() & required) != required) continue;
+            for (size_t c = 0; c < archetype->chunkCount(); ++c) {
+                Archetype::Chunk& chunk = archetype->chunk(c);
+                fn(chunk.count, reinterpret_cast<Ts*>(archetype->column(chunk, componentId<Ts>()))...);
+            }
+        }
+    }
+
+    // fn(Ts&...) or fn(Entity, Ts&...) per entity
+    template <typename... Ts, typename Fn>
+    void each(Fn&& fn) {
+        ComponentMask required = componentMask<Ts...>();
+        for (auto& archetype : archetypes_) {
+            if ((archetype->mask() & required) != required) continue;
+            for (size_t c = 0; c < archetype->chunkCount(); ++c) {
+                Archetype::Chunk& chunk = archetype->chunk(c);
+                std::tuple<Ts*...> columns{
+                    reinterpret_cast<Ts*>(archetype->column(chunk, componentId<Ts>()))...};
+                const Entity* entities = chunk.entities();
+                for (size_t i = 0; i < chunk.count; ++i) {
+                    if constexpr (std::is_invocable_v<Fn&, Entity, Ts&...>) {
+                        fn(entities[i], std::get<Ts*>(columns)[i]...);
+                    } else {
+                        fn(std::get<Ts*>(columns)[i]...);
+                    }
+                }
+            }
+        }
+    }
+
+    // ========================================================================
+    // Flat State Access (snapshots, hashing, interpolation)
+    // ========================================================================
+
+    // fn(ComponentId, std::span<const std::byte>) for every used array: per
+    // archetype (creation order), per chunk, the entity handles
+    // (ENTITY_COLUMN) then each component in id order. Only live rows are
+    // included, so two worlds built the same way produce identical ranges.
+    template <typename Fn>
+    void forEachByteRange(Fn&& fn) const {
+        for (const auto& archetype : archetypes_) {
+            for (size_t c = 0; c < archetype->chunkCount(); ++c) {
+                const Archetype::Chunk& chunk = archetype->chunk(c);
+                fn(ENTITY_COLUMN, std::span<const std::byte>(chunk.data.get(), chunk.count * sizeof(Entity)));
+                for (const Archetype::Column& column : archetype->columns()) {
+                    fn(column.id, std::span<const std::byte>(archetype->column(chunk, column.id),
+                                                             chunk.count * column.size));
+                }
+            }
+        }
+    }
+
+    // One fingerprint of every entity and component (see StateHash.hpp)
+    uint64_t stateHash() const {
+        StateHasher hasher;
+        forEachByteRange([&hasher](ComponentId, std::span<const std::byte> bytes) {
+            hasher.update(bytes.data(), bytes.size());
+        });
+        return hasher.digest();
+    }
+
+    size_t archetypeCount() const { return archetypes_.size(); }
+    const Archetype& archetype(size_t i) const { return *archetypes_[i]; }
+
+    // ========================================================================
+    // Deferred Creation (used by CommandBuffer)
+    // ========================================================================
+
+    // A handle that isn't alive yet (no archetype, invisible to queries)
+    Entity reserve() {
+        uint32_t index;
+        if (!freeIndices_.empty()) {
+            index = freeIndices_.back();
+            freeIndices_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(records_.size());
+            records_.push_back({});
+        }
+        return {index, records_[index].generation};
+    }
+
+    // Makes a reserved handle alive with no components (false if stale)
+    bool place(Entity entity) {
+        if (entity.index >= records_.size() || records_[entity.index].generation != entity.generation ||
+            records_[entity.index].archetype != Entity::INVALID) {
+            return false;
+        }
+        placeIn(entity, 0);
+        return true;
+    }
+
+    // Gives up a reserved handle that was never placed
+    void release(Entity entity) {
+        if (entity.index >= records_.size() || records_[entity.index].generation != entity.generation ||
+            records_[entity.index].archetype != Entity::INVALID) {
+            return;
+        }
+        ++records_[entity.index].generation;
+        freeIndices_.push_back(entity.index);
+    }
+
+    // Type-erased add/remove (bytes = one component of that type)
+    void addRaw(Entity entity, ComponentId id, const void* bytes) {
+        if (!alive(entity)) return;
+        Record& record = records_[entity.index];
+        Archetype* current = archetypes_[record.archetype].get();
+        if (!current->has(id)) {
+            uint32_t& edge = current->addEdges()[id];
+            if (edge == Entity::INVALID) edge = archetypeFor(current->mask() | (ComponentMask{1} << id));
+            move(entity, edge);
+        }
+        Archetype& archetype = *archetypes_[record.archetype];
+        std::memcpy(archetype.component({record.chunk, record.row}, id), bytes, componentInfo(id).size);
+    }
+
+    void removeRaw(Entity entity, ComponentId id) {
+        if (!alive(entity)) return;
+        Archetype* current = archetypes_[records_[entity.index].archetype].get();
+        if (!current->has(id)) return;
+        uint32_t& edge = current->removeEdges()[id];
+        if (edge == Entity::INVALID) edge = archetypeFor(current->mask() & ~(ComponentMask{1} << id));
+        move(entity, edge);
+    }
+
+private:
+    struct Record {
+        uint32_t generation = 0;
+        uint32_t archetype = Entity::INVALID;  // INVALID: free or reserved
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+    };
+
+    uint32_t archetypeFor(ComponentMask mask) {
+        auto found = byMask_.find(mask);
+        if (found != byMask_.end()) return found->second;
+        uint32_t index = static_cast<uint32_t>(archetypes_.size());
+        archetypes_.push_back(std::make_unique<Archetype>(mask));
+        byMask_.emplace(mask, index);
+        return index;
+    }
+
+    uint32_t placeIn(Entity entity, uint32_t archetypeIndex) {
+        Archetype::Row row = archetypes_[archetypeIndex]->pushRow(entity);
+        Record& record = records_[entity.index];
+        record.archetype = archetypeIndex;
+        record.chunk = row.chunk;
+        record.row = row.row;
+        ++alive_;
+        return archetypeIndex;
+    }
+
+    // Removes the entity's row from its archetype, patching whoever moved in
+    void detach(const Record& record) {
+        Archetype& archetype = *archetypes_[record.archetype];
+        Entity moved = archetype.eraseRow({record.chunk, record.row});
+        if (moved.valid()) {
+            records_[moved.index].chunk = record.chunk;
+            records_[moved.index].row = record.row;
+        }
+    }
+
+    // To another archetype, keeping every component both have
+    void move(Entity entity, uint32_t targetIndex) {
+        Record& record = records_[entity.index];
+        Archetype& source = *archetypes_[record.archetype];
+        Archetype& target = *archetypes_[targetIndex];
+
+        Archetype::Row to = target.pushRow(entity);
+        Archetype::Row from{record.chunk, record.row};
+        for (const Archetype::Column& column : source.columns()) {
+            if (target.has(column.id)) {
+                std::memcpy(target.component(to, column.id), source.component(from, column.id), column.size);
+            }
+        }
+        detach(record);
+        record.archetype = targetIndex;
+        record.chunk = to.chunk;
+        record.row = to.row;
+    }
+
+    std::vector<std::unique_ptr<Archetype>> archetypes_;
+    std::unordered_map<ComponentMask, uint32_t> byMask_;
+    std::vector<Record> records_;
+    std::vector<uint32_t> freeIndices_;
+    size_t alive_ = 0;
+};
+#endif  // ECS_WORLD_HPP
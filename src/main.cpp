@@ -8,10 +8,19 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
-#include <fmt/core.h>
 #include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <thread>
 
 #include "app/Application.hpp"
+#include "core/Logger.hpp"
+#include "core/RenderHandoff.hpp"
+#include "core/StartupTrace.hpp"
+#include "core/Timer.hpp"
+#include "ui/DrawDataSnapshot.hpp"
 
 std::string getSettingsPath() {
     const char* home = std::getenv("HOME");
@@ -23,17 +32,147 @@ std::string getSettingsPath() {
     #endif
 }
 
+// Rotating log file next to the settings
+std::string getLogPath() {
+    return (std::filesystem::path(getSettingsPath()).parent_path() / "app.log").string();
+}
+
+// Simulation checkpoint (Save / Load Checkpoint, --resume) next to the settings
+std::string getCheckpointPath() {
+    return (std::filesystem::path(getSettingsPath()).parent_path() / "checkpoint.ckpt").string();
+}
+
+// Flight recorder hitch dumps, next to the settings
+std::string getFlightRecordingDirectory() {
+    return (std::filesystem::path(getSettingsPath()).parent_path() / "flight_recordings").string();
+}
+
+// --metrics-port=N enables the OpenMetrics endpoint on 127.0.0.1:N
+int getMetricsPort(int argc, char* argv[]) {
+    const char* prefix = "--metrics-port=";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], prefix, std::strlen(prefix)) == 0) {
+            return std::atoi(argv[i] + std::strlen(prefix));
+        }
+    }
+    return -1;  // Disabled
+}
+
+// --trace-startup prints the per-phase startup report after the first frame
+bool hasFlag(int argc, char* argv[], const char* flag) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], flag) == 0) return true;
+    }
+    return false;
+}
+
+// --render-thread[=N]: present from a render thread with N frames in
+// flight (default 1). 0 = single-threaded (the default).
+int getRenderThreadFrames(int argc, char* argv[]) {
+    const char* prefix = "--render-thread=";
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--render-thread") == 0) return 1;
+        if (std::strncmp(argv[i], prefix, std::strlen(prefix)) == 0) {
+            return std::atoi(argv[i] + std::strlen(prefix));
+        }
+    }
+    return 0;
+}
+
+// One frame handed to the render thread: the UI plus what it needs from
+// GLFW calls that must stay on the main thread
+struct RenderFrame {
+    DrawDataSnapshot ui;
+    int width = 0;
+    int height = 0;
+    int swapInterval = 1;
+};
+
+using FrameHandoff = RenderHandoff<RenderFrame>;
+
+// Owns the GL context until the handoff stops: submission and swap only.
+// Time to first frame ends at the first swap here, not at the first submit.
+void renderThreadMain(GLFWwindow* window, FrameHandoff& handoff, StartupTrace& startup) {
+    glfwMakeContextCurrent(window);
+    int swapInterval = -1;
+    while (RenderFrame* frame = handoff.waitForFrame()) {
+        if (frame->swapInterval != swapInterval) {
+            swapInterval = frame->swapInterval;
+            glfwSwapInterval(swapInterval);
+        }
+        glViewport(0, 0, frame->width, frame->height);
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData(frame->ui.drawData());
+        glfwSwapBuffers(window);
+        startup.markFirstFrame();  // Ignored after the first
+        handoff.presented(frame);
+    }
+    glfwMakeContextCurrent(nullptr);
+}
+
 int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
+    StartupTrace startup;  // Origin for every startup timing below
+
+    // Everything below logs through this (declared first, so it drains last)
+    LoggerConfig logConfig;
+    logConfig.path = getLogPath();
+    Logger logger(logConfig);
+    Logger::setGlobal(&logger);
+
+    bool traceStartup = hasFlag(argc, argv, "--trace-startup");
+    int metricsPort = getMetricsPort(argc, argv);
+    bool metricsRequested = metricsPort >= 0 && metricsPort <= 65535;
+
+    // ========================================================================
+    // PHASE 0: START BACKGROUND INITIALIZATION
+    // ========================================================================
+    //
+    // Nothing here needs the window or an ImGui context, so it runs on worker
+    // threads while GLFW creates the window (usually the slowest step):
+    // - Application: command registration, settings file parse, metrics socket
+    // - Font atlas: rasterized into a standalone ImFontAtlas, which the ImGui
+    //   context adopts once it's created
+    //
+    // No ImGui context exists until both are joined, so the atlas build
+    // can't race with anything that touches ImGui's global state.
+    //
+
+    auto appReady = std::async(std::launch::async, [&startup, metricsRequested, metricsPort]() {
+        std::unique_ptr<Application> created;
+        {
+            StartupTrace::Scope phase(startup, "app + commands");
+            created = std::make_unique<Application>();
+        }
+        {
+            StartupTrace::Scope phase(startup, "settings parse");
+            created->readSettings(getSettingsPath());
+        }
+        if (metricsRequested) {
+            StartupTrace::Scope phase(startup, "metrics server");
+            created->startMetricsServer(static_cast<uint16_t>(metricsPort));
+        }
+        return created;
+    });
+
+    auto fontsReady = std::async(std::launch::async, [&startup]() {
+        StartupTrace::Scope phase(startup, "font atlas build");
+        auto atlas = std::make_unique<ImFontAtlas>();
+        atlas->AddFontDefault();
+        atlas->Build();
+        return atlas;
+    });
     
     // ========================================================================
     // PHASE 1: INITIALIZE GLFW
     // ========================================================================
     
-    if (!glfwInit()) {
-        fmt::print(stderr, "Failed to initialize GLFW\n");
-        return 1;
+    {
+        StartupTrace::Scope phase(startup, "glfw init");
+        if (!glfwInit()) {
+            logError("Failed to initialize GLFW");
+            return 1;
+        }
     }
     
     // Set OpenGL version (3.3 core profile works everywhere)
@@ -45,47 +184,137 @@ int main(int argc, char* argv[]) {
     #endif
     
     // Create window
-    GLFWwindow* window = glfwCreateWindow(1280, 720, "ImGui App Shell", nullptr, nullptr);
-    if (!window) {
-        fmt::print(stderr, "Failed to create GLFW window\n");
-        glfwTerminate();
-        return 1;
+    GLFWwindow* window = nullptr;
+    {
+        StartupTrace::Scope phase(startup, "window + GL context");
+        window = glfwCreateWindow(1280, 720, "ImGui App Shell", nullptr, nullptr);
+        if (!window) {
+            logError("Failed to create GLFW window");
+            glfwTerminate();
+            return 1;
+        }
+        
+        glfwMakeContextCurrent(window);
+        glfwSwapInterval(1);  // Enable vsync
     }
     
-    glfwMakeContextCurrent(window);
-    glfwSwapInterval(1);  // Enable vsync
-    
     // Load OpenGL functions using glad (or your preferred loader)
     // Note: You'll need to add glad to your project or use another loader
+
+    // Input events, timestamped as they arrive and delivered per fixed tick.
+    // Installed BEFORE the ImGui backend, which chains to them. The
+    // Application is attached below.
+    glfwSetKeyCallback(window, [](GLFWwindow* w, int key, int, int action, int mods) {
+        if (auto* app = static_cast<Application*>(glfwGetWindowUserPointer(w))) {
+            app->queueInput(InputDevice::Key, key, action, mods);
+        }
+    });
+    glfwSetMouseButtonCallback(window, [](GLFWwindow* w, int button, int action, int mods) {
+        if (auto* app = static_cast<Application*>(glfwGetWindowUserPointer(w))) {
+            app->queueInput(InputDevice::MouseButton, button, action, mods);
+        }
+    });
     
     // ========================================================================
     // PHASE 2: INITIALIZE DEAR IMGUI
     // ========================================================================
     
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
-    ImGuiIO& io = ImGui::GetIO();
-    io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
-    
-    ImGui::StyleColorsDark();
-    
-    ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init("#version 330");
+    std::unique_ptr<ImFontAtlas> fontAtlas;  // Shared with (not owned by) the context
+    {
+        StartupTrace::Scope phase(startup, "wait: font atlas");
+        fontAtlas = fontsReady.get();
+    }
+
+    {
+        StartupTrace::Scope phase(startup, "imgui + backends");
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext(fontAtlas.get());
+        ImGuiIO& io = ImGui::GetIO();
+        io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+        
+        ImGui::StyleColorsDark();
+        
+        ImGui_ImplGlfw_InitForOpenGL(window, true);
+        ImGui_ImplOpenGL3_Init("#version 330");
+    }
     
     // ========================================================================
     // PHASE 3: CREATE APPLICATION
     // ========================================================================
     
-    Application app;
-    app.loadSettings(getSettingsPath());
+    std::unique_ptr<Application> appOwner;
+    {
+        StartupTrace::Scope phase(startup, "wait: application");
+        appOwner = appReady.get();
+    }
+    Application& app = *appOwner;
+    app.applySettings();  // The theme needs the ImGui context: main thread only
+    glfwSetWindowUserPointer(window, &app);
+
+    // --resume: continue from the last saved checkpoint instead of tick 0
+    app.setCheckpointPath(getCheckpointPath());
+    app.setFlightRecordingDirectory(getFlightRecordingDirectory());
+    if (hasFlag(argc, argv, "--resume")) app.loadCheckpoint();
+
+    // --perf-counters: per frame / tick / UI counters in the timing panel.
+    // Opened here, on the thread that runs the loop (counters are per thread).
+    if (hasFlag(argc, argv, "--perf-counters")) {
+        if (!app.enablePerfCounters()) {
+            logWarn("Hardware counters disabled: {}", app.perfCounters().error());
+        } else if (!app.perfCounters().error().empty()) {
+            logWarn("Some hardware counters {}", app.perfCounters().error());
+        }
+    }
+
+    if (metricsRequested) {
+        if (app.metricsPort() != 0) {
+            logInfo("Serving metrics on http://127.0.0.1:{}/metrics", app.metricsPort());
+        } else {
+            logError("Failed to start metrics server on port {}", metricsPort);
+        }
+    }
     
+    // --render-thread: the GL context moves to a render thread. Device
+    // objects (shaders, font texture) are created here first, so the render
+    // thread never touches ImGui state the main thread is using.
+    std::unique_ptr<FrameHandoff> handoff;
+    std::thread renderThread;
+    int renderThreadFrames = getRenderThreadFrames(argc, argv);
+    if (renderThreadFrames > 0 && !DrawDataSnapshot::SUPPORTED) {
+        logWarn("--render-thread ignored: ImGui {} updates textures during rendering (needs < 1.92)",
+                IMGUI_VERSION);
+        renderThreadFrames = 0;
+    }
+    if (renderThreadFrames > 0) {
+        ImGui_ImplOpenGL3_NewFrame();
+        glfwMakeContextCurrent(nullptr);
+        handoff = std::make_unique<FrameHandoff>(static_cast<size_t>(renderThreadFrames));
+        renderThread = std::thread(renderThreadMain, window, std::ref(*handoff), std::ref(startup));
+        logInfo("Rendering on a separate thread, {} frame(s) in flight", handoff->framesInFlight());
+    }
+
     // ========================================================================
     // PHASE 4: MAIN LOOP
     // ========================================================================
     bool commandPaletteKeyWasPressed = false;
+    bool vsyncEnabled = true;
+    Timer frameTimer;
+    Timer phaseTimer;  // Per-phase breakdown for the flight recorder
+    bool startupReported = false;
 
     while (!glfwWindowShouldClose(window)) {
+        phaseTimer.rest();
         glfwPollEvents();
+        app.recordFramePhase(FramePhase::Events, phaseTimer.lap());
+
+        // Advance the simulation by the real time since the last frame
+        app.update(frameTimer.lap());
+
+        // Turbo: vsync would cap the whole loop (and the sim) at the display rate
+        if (app.isTurbo() == vsyncEnabled) {
+            vsyncEnabled = !app.isTurbo();
+            if (!handoff) glfwSwapInterval(vsyncEnabled ? 1 : 0);  // Else per RenderFrame
+        }
         
         // Handle keyboard shortcuts
         bool commandPaletteKeyIsPressed = 
@@ -104,9 +333,15 @@ int main(int argc, char* argv[]) {
         if (app.shouldQuit()) {
             glfwSetWindowShouldClose(window, true);
         }
+
+        // Turbo mode only renders every so often; skip the ImGui frame and swap
+        if (!app.shouldRenderFrame()) {
+            continue;
+        }
         
         // Start ImGui frame
-        ImGui_ImplOpenGL3_NewFrame();
+        phaseTimer.rest();
+        if (!handoff) ImGui_ImplOpenGL3_NewFrame();  // Needs the GL context
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
         
@@ -115,14 +350,39 @@ int main(int argc, char* argv[]) {
         
         // Finalize and present
         ImGui::Render();
-        int display_w, display_h;
-        glfwGetFramebufferSize(window, &display_w, &display_h);
-        glViewport(0, 0, display_w, display_h);
-        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-        
-        glfwSwapBuffers(window);
+        app.recordFramePhase(FramePhase::Ui, phaseTimer.lap());
+        if (handoff) {
+            // Render phase = waiting for a free frame + the copy; the
+            // present itself overlaps with building the next frame
+            RenderFrame* frame = handoff->acquire();
+            if (!frame) break;
+            frame->ui.capture(*ImGui::GetDrawData());
+            glfwGetFramebufferSize(window, &frame->width, &frame->height);
+            frame->swapInterval = vsyncEnabled ? 1 : 0;
+            handoff->submit(frame, app.markSubmitted());
+            PresentedFrame presented;
+            while (handoff->pollPresented(presented)) app.framePresented(presented);
+            app.recordFramePhase(FramePhase::Render, phaseTimer.lap());
+        } else {
+            int display_w, display_h;
+            glfwGetFramebufferSize(window, &display_w, &display_h);
+            glViewport(0, 0, display_w, display_h);
+            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+            glfwSwapBuffers(window);
+            startup.markFirstFrame();  // Ignored after the first
+            app.markPresented();
+            app.recordFramePhase(FramePhase::Render, phaseTimer.lap());
+        }
+
+        // Render-thread mode: reported a frame or two later, once that
+        // thread has swapped
+        if (!startupReported && startup.timeToFirstFrame() >= 0.0) {
+            startupReported = true;
+            if (traceStartup) logInfo("{}", startup.report());
+        }
     }
     
     // ========================================================================
@@ -130,6 +390,13 @@ int main(int argc, char* argv[]) {
     // ========================================================================
     
     app.saveSettings(getSettingsPath());
+    glfwSetWindowUserPointer(window, nullptr);
+
+    if (handoff) {
+        handoff->stop();
+        renderThread.join();
+        glfwMakeContextCurrent(window);  // The GL backend frees its objects below
+    }
     
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
@@ -0,0 +1,134 @@
+// ============================================================================
+// MetricsServer.cpp - Implementation
+// ============================================================================
+
+#include "MetricsServer.hpp"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define METRICS_SERVER_POSIX 1
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // macOS: SIGPIPE is disabled per socket instead (SO_NOSIGPIPE)
+#endif
+#endif
+
+// ============================================================================
+// Start / Stop
+// ============================================================================
+
+#ifdef METRICS_SERVER_POSIX
+
+bool MetricsServer::start(uint16_t port) {
+    if (isRunning()) return true;
+
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) return false;
+
+    int reuse = 1;
+    ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);  // Local only, never exposed
+    addr.sin_port = htons(port);
+
+    socklen_t len = sizeof(addr);
+    if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listenFd_, 8) != 0 ||
+        ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        ::close(listenFd_);
+        listenFd_ = -1;
+        return false;
+    }
+    port_ = ntohs(addr.sin_port);
+
+    running_.store(true);
+    thread_ = std::thread([this]() { serve(); });
+    return true;
+}
+
+void MetricsServer::stop() {
+    if (!running_.exchange(false)) return;
+    thread_.join();  // serve() polls with a timeout, so it notices within ~100 ms
+    ::close(listenFd_);
+    listenFd_ = -1;
+}
+
+// ============================================================================
+// Server Thread
+// ============================================================================
+
+void MetricsServer::serve() {
+    while (running_.load()) {
+        pollfd pfd{listenFd_, POLLIN, 0};
+        if (::poll(&pfd, 1, 100) <= 0) continue;  // Timeout: re-check running_
+
+        int client = ::accept(listenFd_, nullptr, nullptr);
+        if (client < 0) continue;
+#ifdef SO_NOSIGPIPE
+        int noSigPipe = 1;
+        ::setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+        handleClient(client);
+        ::close(client);
+    }
+}
+
+void MetricsServer::handleClient(int clientFd) {
+    // Read until the end of the request headers (we ignore any body).
+    // A client that stalls for more than a second is dropped.
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+        pollfd pfd{clientFd, POLLIN, 0};
+        if (::poll(&pfd, 1, 1000) <= 0) return;
+        ssize_t n = ::recv(clientFd, buffer, sizeof(buffer), 0);
+        if (n <= 0) return;
+        request.append(buffer, static_cast<size_t>(n));
+    }
+
+    std::string_view line(request);
+    line = line.substr(0, line.find("\r\n"));
+
+    std::string response;
+    if (line.starts_with("GET /metrics ") || line.starts_with("GET /metrics?")) {
+        handoff_.acquire();  // Newest snapshot, if the loop published one since last scrape
+        std::string body = openmetrics::format(handoff_.readBuffer());
+        response = "HTTP/1.1 200 OK\r\n"
+                   "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+                   "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                   "Connection: close\r\n\r\n" + body;
+    } else {
+        response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+    }
+
+    size_t sent = 0;
+    while (sent < response.size()) {
+        ssize_t n = ::send(clientFd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return;
+        sent += static_cast<size_t>(n);
+    }
+}
+
+#else  // No socket implementation on this platform
+
+bool MetricsServer::start(uint16_t port) {
+    (void)port;
+    return false;
+}
+
+void MetricsServer::stop() {}
+
+void MetricsServer::serve() {}
+
+void MetricsServer::handleClient(int clientFd) { (void)clientFd; }
+
+#endif
@@ -0,0 +1,61 @@
+// ============================================================================
+// MetricsServer.hpp - Local OpenMetrics HTTP Endpoint
+// Serves `GET /metrics` on 127.0.0.1 so Prometheus (or curl) can scrape
+// loop timing from a running instance.
+// ============================================================================
+//
+// THREADING:
+// The frame loop calls publish() once per frame. That is a copy plus one
+// atomic exchange into a TripleBuffer — it never waits on the server thread,
+// so a slow or stuck scraper can't stall a frame. The server thread picks up
+// the newest snapshot when a request arrives and formats it there.
+//
+// Only POSIX sockets are implemented; on other platforms start() returns false.
+//
+
+#ifndef METRICSSERVER_HPP
+#define METRICSSERVER_HPP
+
+#include "../core/LoopMetrics.hpp"
+#include "../core/TripleBuffer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+class MetricsServer {
+public:
+    MetricsServer() = default;
+    ~MetricsServer() { stop(); }
+
+    // Non-copyable (owns a socket and a thread)
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    // Bind to 127.0.0.1:port and start serving. Port 0 picks a free port
+    // (see port()). Returns false if the socket couldn't be set up.
+    bool start(uint16_t port);
+
+    // Stop the server thread and close the socket (safe to call twice)
+    void stop();
+
+    bool isRunning() const { return running_.load(std::memory_order_relaxed); }
+
+    // The port actually bound (useful after start(0))
+    uint16_t port() const { return port_; }
+
+    // Called from the frame loop; never blocks
+    void publish(const LoopMetricsSnapshot& snapshot) { handoff_.publish(snapshot); }
+
+private:
+    void serve();
+    void handleClient(int clientFd);
+
+    TripleBuffer<LoopMetricsSnapshot> handoff_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    int listenFd_ = -1;
+    uint16_t port_ = 0;
+};
+
+#endif // METRICSSERVER_HPP
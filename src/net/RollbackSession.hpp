@@ -0,0 +1,302 @@
+// RollbackSession.hpp - GGPO-Style Rollback Lockstep over a Transport
+// ============================================================================
+// PURPOSE: Keep two or more peers running the same deterministic game while
+// exchanging nothing but inputs, without making anyone wait for the network:
+//
+// 1. Each frame the local input is stamped for frame + inputDelay and sent
+//    to every peer (with all inputs they haven't acknowledged yet, so a lost
+//    packet is repaired by the next one).
+// 2. The frame is simulated immediately. Remote inputs that haven't arrived
+//    are PREDICTED by repeating that player's last confirmed input.
+// 3. When a remote input arrives for a frame already simulated and differs
+//    from the prediction, the session restores the state saved at the start
+//    of that frame and re-simulates up to the present — all inside the next
+//    advanceFrame(), so the game only ever sees corrected state.
+//
+//   RollbackSession<RollbackDemoGame> session(game, transport, config);
+//   while (running) {
+//       if (!session.advanceFrame(readLocalInput())) continue;  // Stalled
+//   }
+//
+// A peer never runs more than maxPrediction frames past the last frame for
+// which it has every player's input; beyond that advanceFrame() returns
+// false (a stall) until inputs arrive. States are kept for RING frames.
+//
+// COST: re-simulation is the price of hiding latency — with N frames of
+// prediction a mispredicted input costs up to N extra game steps inside one
+// frame. stats() and lastResimSeconds() measure it per frame.
+//
+// Game requirements:
+//   typename Game::State;                    default-constructible, copyable
+//   void saveState(State&) const;            reuse the State's storage
+//   void loadState(const State&);
+//   void step(std::span<const uint32_t>);    one input per player
+//   static uint64_t checksum(const State&);
+//
+
+#ifndef ROLLBACK_SESSION_HPP
+#define ROLLBACK_SESSION_HPP
+#include <algorithm>  // for std::min, std::max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t, uint64_t
+#include <cstring>    // for std::memcpy
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "../core/Timer.hpp"
+#include "Transport.hpp"
+
+struct RollbackConfig {
+    uint32_t players = 2;
+    uint32_t localPlayer = 0;    // Also this peer's transport index
+    uint32_t inputDelay = 2;     // Frames between reading an input and using it (max 16)
+    uint32_t maxPrediction = 8;  // Frames allowed past the last confirmed frame (max 32)
+};
+
+struct RollbackStats {
+    uint64_t frames = 0;             // Frames advanced
+    uint64_t stalls = 0;             // advanceFrame() calls that waited on inputs
+    uint64_t rollbacks = 0;          // Frames that had to re-simulate
+    uint64_t resimulatedFrames = 0;  // Game steps spent re-simulating
+    uint64_t packetsSent = 0;
+    uint64_t packetsReceived = 0;
+    double resimSeconds = 0.0;       // Total time spent re-simulating
+    double maxResimSeconds = 0.0;    // Worst single frame
+    uint32_t maxRollbackFrames = 0;  // Deepest rollback
+};
+
+template <typename Game>
+class RollbackSession {
+public:
+    static constexpr uint32_t RING = 128;  // Frames of saved state and inputs
+    static constexpr uint32_t MAX_INPUT_DELAY = 16;
+    static constexpr uint32_t MAX_PREDICTION = 32;
+    static constexpr uint32_t MAX_INPUTS_PER_PACKET = 64;
+
+    RollbackSession(Game& game, Transport& transport, const RollbackConfig& config)
+        : game_(game), transport_(transport), config_(config) {
+        config_.inputDelay = std::min(config_.inputDelay, MAX_INPUT_DELAY);
+        config_.maxPrediction = std::min(config_.maxPrediction, MAX_PREDICTION);
+
+        size_t slots = size_t{config_.players} * RING;
+        inputs_.assign(slots, 0);
+        used_.assign(slots, 0);
+        // Frames inside the input delay have no input from anyone: all zero
+        confirmedThrough_.assign(config_.players, static_cast<int64_t>(config_.inputDelay) - 1);
+        ackedBy_.assign(config_.players, config_.inputDelay);
+        frameInputs_.resize(config_.players);
+        states_.resize(RING);
+    }
+
+    // Non-copyable (holds references to the game and transport)
+    RollbackSession(const RollbackSession&) = delete;
+    RollbackSession& operator=(const RollbackSession&) = delete;
+
+    // ========================================================================
+    // Per Frame
+    // ========================================================================
+
+    // Receives inputs, rolls back if a prediction was wrong, then simulates
+    // one frame. Returns false (and does not consume localInput) if this
+    // peer is too far ahead of the slowest confirmed input.
+    bool advanceFrame(uint32_t localInput) {
+        lastResimSeconds_ = 0.0;
+        lastResimFrames_ = 0;
+        receiveInputs();
+        if (rollbackFrom_ < frame_) rollback();
+
+        if (static_cast<int64_t>(frame_) > confirmedFrame() + config_.maxPrediction) {
+            ++stats_.stalls;
+            sendInputs();  // Resend: the missing input may be waiting on our ack
+            return false;
+        }
+
+        uint32_t inputFrame = frame_ + config_.inputDelay;
+        input(config_.localPlayer, inputFrame) = localInput;
+        confirmedThrough_[config_.localPlayer] = inputFrame;
+        sendInputs();
+
+        simulate(frame_);
+        ++frame_;
+        ++stats_.frames;
+        recordChecksums();
+        return true;
+    }
+
+    // ========================================================================
+    // State
+    // ========================================================================
+
+    // Next frame to simulate (= frames simulated so far)
+    uint32_t frame() const { return frame_; }
+
+    // Last frame for which every player's input is known (-1 = none)
+    int64_t confirmedFrame() const {
+        int64_t confirmed = std::numeric_limits<int64_t>::max();
+        for (int64_t through : confirmedThrough_) confirmed = std::min(confirmed, through);
+        return confirmed;
+    }
+
+    // Game::checksum of the state at the START of each frame, recorded once
+    // every input before that frame is confirmed (so it is final). Index =
+    // frame. Identical across peers unless they have desynced.
+    const std::vector<uint64_t>& checksums() const { return checksums_; }
+
+    const RollbackStats& stats() const { return stats_; }
+    const RollbackConfig& config() const { return config_; }
+
+    // Re-simulation done by the most recent advanceFrame() (0 if none)
+    double lastResimSeconds() const { return lastResimSeconds_; }
+    uint32_t lastResimFrames() const { return lastResimFrames_; }
+
+private:
+    static constexpr uint32_t NO_ROLLBACK = std::numeric_limits<uint32_t>::max();
+    static constexpr uint8_t INPUT_PACKET = 1;
+
+    // Packet: type u8, player u8, ack u32, first u32, count u16, inputs u32[count]
+    static constexpr size_t PACKET_HEADER = 1 + 1 + 4 + 4 + 2;
+
+    uint32_t& input(uint32_t player, uint32_t frame) {
+        return inputs_[size_t{player} * RING + frame % RING];
+    }
+
+    // Confirmed input, or the prediction: that player's last confirmed input
+    uint32_t bestInput(uint32_t player, uint32_t frame) {
+        int64_t through = confirmedThrough_[player];
+        if (static_cast<int64_t>(frame) <= through) return input(player, frame);
+        return through >= 0 ? input(player, static_cast<uint32_t>(through)) : 0;
+    }
+
+    void simulate(uint32_t frame) {
+        game_.saveState(states_[frame % RING]);
+        for (uint32_t p = 0; p < config_.players; ++p) {
+            frameInputs_[p] = bestInput(p, frame);
+            used_[size_t{p} * RING + frame % RING] = frameInputs_[p];
+        }
+        game_.step(std::span<const uint32_t>(frameInputs_));
+    }
+
+    void rollback() {
+        uint32_t from = rollbackFrom_;
+        rollbackFrom_ = NO_ROLLBACK;
+
+        Timer timer;
+        game_.loadState(states_[from % RING]);
+        for (uint32_t f = from; f < frame_; ++f) simulate(f);
+        double seconds = timer.elapsed();
+
+        lastResimSeconds_ = seconds;
+        lastResimFrames_ = frame_ - from;
+        ++stats_.rollbacks;
+        stats_.resimulatedFrames += lastResimFrames_;
+        stats_.resimSeconds += seconds;
+        stats_.maxResimSeconds = std::max(stats_.maxResimSeconds, seconds);
+        stats_.maxRollbackFrames = std::max(stats_.maxRollbackFrames, lastResimFrames_);
+    }
+
+    void recordChecksums() {
+        // The state at the start of frame f is final once inputs < f are
+        // confirmed; it was saved when frame f was (re)simulated
+        int64_t last = std::min(confirmedFrame() + 1, static_cast<int64_t>(frame_) - 1);
+        while (static_cast<int64_t>(checksums_.size()) <= last) {
+            uint32_t f = static_cast<uint32_t>(checksums_.size());
+            checksums_.push_back(Game::checksum(states_[f % RING]));
+        }
+    }
+
+    // ========================================================================
+    // Wire Format
+    // ========================================================================
+
+    void sendInputs() {
+        uint32_t local = config_.localPlayer;
+        int64_t latest = confirmedThrough_[local];
+        if (latest < 0) return;
+
+        for (uint32_t peer = 0; peer < config_.players; ++peer) {
+            if (peer == local) continue;
+            uint32_t first = ackedBy_[peer];
+            uint32_t count = 0;  // Zero still carries our ack
+            if (static_cast<int64_t>(first) <= latest) {
+                count = static_cast<uint32_t>(
+                    std::min<int64_t>(latest + 1 - first, MAX_INPUTS_PER_PACKET));
+            }
+
+            packet_.resize(PACKET_HEADER + size_t{count} * 4);
+            uint8_t* out = packet_.data();
+            uint32_t ack = static_cast<uint32_t>(confirmedThrough_[peer] + 1);
+            uint16_t count16 = static_cast<uint16_t>(count);
+            out[0] = INPUT_PACKET;
+            out[1] = static_cast<uint8_t>(local);
+            std::memcpy(out + 2, &ack, 4);
+            std::memcpy(out + 6, &first, 4);
+            std::memcpy(out + 10, &count16, 2);
+            for (uint32_t i = 0; i < count; ++i) {
+                std::memcpy(out + PACKET_HEADER + i * 4, &input(local, first + i), 4);
+            }
+            transport_.send(peer, packet_);
+            ++stats_.packetsSent;
+        }
+    }
+
+    void receiveInputs() {
+        while (transport_.receive(received_)) {
+            const std::vector<uint8_t>& bytes = received_.bytes;
+            if (bytes.size() < PACKET_HEADER || bytes[0] != INPUT_PACKET) continue;
+            uint32_t player = bytes[1];
+            if (player >= config_.players || player == config_.localPlayer) continue;
+            ++stats_.packetsReceived;
+
+            uint32_t ack = 0, first = 0;
+            uint16_t count = 0;
+            std::memcpy(&ack, bytes.data() + 2, 4);
+            std::memcpy(&first, bytes.data() + 6, 4);
+            std::memcpy(&count, bytes.data() + 10, 2);
+            if (bytes.size() < PACKET_HEADER + size_t{count} * 4) continue;
+
+            ackedBy_[player] = std::max(ackedBy_[player], ack);
+
+            for (uint32_t i = 0; i < count; ++i) {
+                uint32_t f = first + i;
+                int64_t through = confirmedThrough_[player];
+                if (static_cast<int64_t>(f) <= through) continue;  // Already have it
+                if (static_cast<int64_t>(f) != through + 1) break;  // Gap: a resend fills it
+                if (f >= frame_ + RING / 2) break;                  // Too far ahead to store
+
+                uint32_t value = 0;
+                std::memcpy(&value, bytes.data() + PACKET_HEADER + i * 4, 4);
+                input(player, f) = value;
+                confirmedThrough_[player] = f;
+
+                // Already simulated with a prediction that turned out wrong
+                if (f < frame_ && used_[size_t{player} * RING + f % RING] != value) {
+                    rollbackFrom_ = std::min(rollbackFrom_, f);
+                }
+            }
+        }
+    }
+
+    Game& game_;
+    Transport& transport_;
+    RollbackConfig config_;
+
+    uint32_t frame_ = 0;
+    uint32_t rollbackFrom_ = NO_ROLLBACK;
+
+    std::vector<uint32_t> inputs_;           // [player * RING + frame % RING]
+    std::vector<uint32_t> used_;             // What each frame was last simulated with
+    std::vector<int64_t> confirmedThrough_;  // Per player: inputs known up to here
+    std::vector<uint32_t> ackedBy_;          // Per peer: first local input they lack
+    std::vector<uint32_t> frameInputs_;
+    std::vector<typename Game::State> states_;
+    std::vector<uint64_t> checksums_;
+
+    Packet received_;
+    std::vector<uint8_t> packet_;
+
+    RollbackStats stats_;
+    double lastResimSeconds_ = 0.0;
+    uint32_t lastResimFrames_ = 0;
+};
+#endif  // ROLLBACK_SESSION_HPP
@@ -0,0 +1,211 @@
+// Transport.hpp - Unreliable Datagram Transport with Injectable Impairment
+// ============================================================================
+// PURPOSE: The minimum a rollback session needs from the network: send a
+// small datagram to a peer, receive whatever has arrived. Delivery is
+// unreliable and unordered, exactly like UDP — the session is responsible
+// for redundancy.
+//
+// Two implementations:
+// - LoopbackNetwork (here): all peers in one process, one inbox per peer
+// - UdpTransport (UdpTransport.hpp): real sockets on 127.0.0.1
+//
+// Both push outgoing packets through an ImpairedLink first, which holds each
+// one back for latency + random jitter (so packets can reorder) or drops it.
+// The link is seeded and reads time from a clock policy (see Timer.hpp), so
+// with VirtualClock a whole lossy session replays identically.
+//
+
+#ifndef TRANSPORT_HPP
+#define TRANSPORT_HPP
+#include <algorithm>  // for std::push_heap, std::pop_heap
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t, uint64_t
+#include <deque>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "../core/Timer.hpp"
+
+struct Packet {
+    uint32_t from = 0;  // Sender's peer index
+    std::vector<uint8_t> bytes;
+};
+
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    // Index of this endpoint (0 .. peers-1)
+    virtual uint32_t localPeer() const = 0;
+
+    // Fire and forget; may be delayed, reordered or dropped
+    virtual void send(uint32_t to, std::span<const uint8_t> bytes) = 0;
+
+    // Pops one arrived packet. Never blocks; false when nothing is waiting.
+    virtual bool receive(Packet& out) = 0;
+};
+
+// ============================================================================
+// Link Conditions
+// ============================================================================
+
+struct LinkConditions {
+    double latencySeconds = 0.0;  // One-way delay added to every packet
+    double jitterSeconds = 0.0;   // Plus uniform [0, jitter) on top
+    double loss = 0.0;            // Probability a packet is dropped (0..1)
+    uint64_t seed = 1;
+};
+
+// Holds outgoing packets until they are due. One per sender.
+template <typename Clock = Timer::Clock>
+class ImpairedLink {
+public:
+    explicit ImpairedLink(const LinkConditions& conditions = {})
+        : conditions_(conditions), rng_(conditions.seed * 0x9E3779B97F4A7C15ULL + 1) {}
+
+    void setConditions(const LinkConditions& conditions) {
+        conditions_ = conditions;
+        rng_ = conditions.seed * 0x9E3779B97F4A7C15ULL + 1;
+    }
+    const LinkConditions& conditions() const { return conditions_; }
+
+    void push(uint32_t to, std::span<const uint8_t> bytes) {
+        ++sent_;
+        if (conditions_.loss > 0.0 && randomUnit() < conditions_.loss) {
+            ++dropped_;
+            return;
+        }
+        double delay = conditions_.latencySeconds + conditions_.jitterSeconds * randomUnit();
+        queue_.push_back({now() + delay, order_++, to, {bytes.begin(), bytes.end()}});
+        std::push_heap(queue_.begin(), queue_.end(), later);
+    }
+
+    // Calls deliver(to, bytes) for every packet that is due, earliest first
+    template <typename Deliver>
+    void drain(Deliver&& deliver) {
+        double current = now();
+        while (!queue_.empty() && queue_.front().dueSeconds <= current) {
+            std::pop_heap(queue_.begin(), queue_.end(), later);
+            Held held = std::move(queue_.back());
+            queue_.pop_back();
+            deliver(held.to, std::move(held.bytes));
+        }
+    }
+
+    size_t inFlight() const { return queue_.size(); }
+    uint64_t sent() const { return sent_; }
+    uint64_t dropped() const { return dropped_; }
+
+private:
+    struct Held {
+        double dueSeconds;
+        uint64_t order;  // Ties (zero jitter) stay in send order
+        uint32_t to;
+        std::vector<uint8_t> bytes;
+    };
+
+    // Min-heap on due time
+    static bool later(const Held& a, const Held& b) {
+        return a.dueSeconds != b.dueSeconds ? a.dueSeconds > b.dueSeconds : a.order > b.order;
+    }
+
+    static double now() {
+        return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+    }
+
+    // xorshift64* mapped to [0, 1)
+    double randomUnit() {
+        rng_ ^= rng_ >> 12;
+        rng_ ^= rng_ << 25;
+        rng_ ^= rng_ >> 27;
+        return static_cast<double>((rng_ * 0x2545F4914F6CDD1DULL) >> 11) / 9007199254740992.0;
+    }
+
+    LinkConditions conditions_;
+    uint64_t rng_;
+    uint64_t order_ = 0;
+    uint64_t sent_ = 0;
+    uint64_t dropped_ = 0;
+    std::vector<Held> queue_;
+};
+
+// ============================================================================
+// LoopbackNetwork - Every Peer in One Process
+// ============================================================================
+//
+//   LoopbackNetwork<VirtualClock> network(2, conditions);
+//   Transport& a = network.endpoint(0);
+//   Transport& b = network.endpoint(1);
+//
+// Not thread-safe: drive all endpoints from one thread.
+//
+
+template <typename Clock = Timer::Clock>
+class LoopbackNetwork {
+public:
+    explicit LoopbackNetwork(uint32_t peers, const LinkConditions& conditions = {})
+        : inboxes_(peers) {
+        for (uint32_t peer = 0; peer < peers; ++peer) {
+            LinkConditions perSender = conditions;
+            perSender.seed = conditions.seed + peer;  // Independent loss per direction
+            links_.push_back(std::make_unique<ImpairedLink<Clock>>(perSender));
+            endpoints_.push_back(std::make_unique<Endpoint>(*this, peer));
+        }
+    }
+
+    // Non-copyable (endpoints point back at the network)
+    LoopbackNetwork(const LoopbackNetwork&) = delete;
+    LoopbackNetwork& operator=(const LoopbackNetwork&) = delete;
+
+    Transport& endpoint(uint32_t peer) { return *endpoints_[peer]; }
+    uint32_t peers() const { return static_cast<uint32_t>(endpoints_.size()); }
+
+    // Outgoing conditions for one sender (asymmetric links)
+    ImpairedLink<Clock>& link(uint32_t from) { return *links_[from]; }
+
+    uint64_t dropped() const {
+        uint64_t total = 0;
+        for (const auto& link : links_) total += link->dropped();
+        return total;
+    }
+
+private:
+    class Endpoint : public Transport {
+    public:
+        Endpoint(LoopbackNetwork& network, uint32_t peer) : network_(network), peer_(peer) {}
+
+        uint32_t localPeer() const override { return peer_; }
+
+        void send(uint32_t to, std::span<const uint8_t> bytes) override {
+            if (to < network_.peers() && to != peer_) network_.links_[peer_]->push(to, bytes);
+        }
+
+        bool receive(Packet& out) override {
+            network_.pump();
+            std::deque<Packet>& inbox = network_.inboxes_[peer_];
+            if (inbox.empty()) return false;
+            out = std::move(inbox.front());
+            inbox.pop_front();
+            return true;
+        }
+
+    private:
+        LoopbackNetwork& network_;
+        uint32_t peer_;
+    };
+
+    // Move everything that is due into the receivers' inboxes
+    void pump() {
+        for (uint32_t from = 0; from < links_.size(); ++from) {
+            links_[from]->drain([this, from](uint32_t to, std::vector<uint8_t>&& bytes) {
+                inboxes_[to].push_back({from, std::move(bytes)});
+            });
+        }
+    }
+
+    std::vector<std::deque<Packet>> inboxes_;
+    std::vector<std::unique_ptr<ImpairedLink<Clock>>> links_;
+    std::vector<std::unique_ptr<Endpoint>> endpoints_;
+};
+#endif  // TRANSPORT_HPP
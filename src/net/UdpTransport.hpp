@@ -0,0 +1,175 @@
+// UdpTransport.hpp - Transport over Real UDP Sockets on 127.0.0.1
+// ============================================================================
+// PURPOSE: The same Transport as LoopbackNetwork, but through the kernel's
+// UDP stack, so a rollback session can be exercised across processes (or
+// threads) on one machine. Outgoing packets still go through an
+// ImpairedLink before sendto(), which is how latency, jitter and loss are
+// injected on localhost (where the real network adds none).
+//
+//   UdpTransport<> transport(peer, conditions);
+//   transport.open(0);                              // Any free port
+//   transport.setPeerPorts({portOf0, portOf1});     // Index = peer
+//
+// Packets that are held back are only sent from send()/receive()/flush(),
+// so call receive() at least once per frame (a rollback session does).
+//
+// Only POSIX sockets are implemented; on other platforms open() returns false.
+//
+
+#ifndef UDP_TRANSPORT_HPP
+#define UDP_TRANSPORT_HPP
+#include <cstdint>
+#include <cstring>  // for std::memcpy
+#include <span>
+#include <utility>  // for std::move
+#include <vector>
+
+#include "Transport.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define UDP_TRANSPORT_POSIX 1
+#endif
+
+template <typename Clock = Timer::Clock>
+class UdpTransport : public Transport {
+public:
+    // Every datagram starts with the sender's peer index
+    static constexpr size_t HEADER_BYTES = sizeof(uint32_t);
+    static constexpr size_t MAX_DATAGRAM = 1400;
+
+    explicit UdpTransport(uint32_t peer, const LinkConditions& conditions = {})
+        : peer_(peer), link_(conditions) {}
+
+    ~UdpTransport() override { close(); }
+
+    // Non-copyable (owns a socket)
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+    // Bind to 127.0.0.1:port. Port 0 picks a free port (see port()).
+    bool open(uint16_t port);
+    void close();
+
+    uint16_t port() const { return port_; }
+
+    // Where each peer listens, indexed by peer (own entry ignored)
+    void setPeerPorts(std::vector<uint16_t> ports) { peerPorts_ = std::move(ports); }
+
+    uint32_t localPeer() const override { return peer_; }
+
+    void send(uint32_t to, std::span<const uint8_t> bytes) override {
+        if (to == peer_ || to >= peerPorts_.size()) return;
+        link_.push(to, bytes);
+        flush();
+    }
+
+    bool receive(Packet& out) override;
+
+    // Send everything the link has finished holding back
+    void flush() {
+        link_.drain([this](uint32_t to, std::vector<uint8_t>&& bytes) { sendNow(to, bytes); });
+    }
+
+    ImpairedLink<Clock>& link() { return link_; }
+
+private:
+    void sendNow(uint32_t to, const std::vector<uint8_t>& bytes);
+
+    uint32_t peer_;
+    ImpairedLink<Clock> link_;
+    std::vector<uint16_t> peerPorts_;
+    std::vector<uint8_t> scratch_;
+    int fd_ = -1;
+    uint16_t port_ = 0;
+};
+
+// ============================================================================
+// Implementation
+// ============================================================================
+
+#ifdef UDP_TRANSPORT_POSIX
+
+template <typename Clock>
+bool UdpTransport<Clock>::open(uint16_t port) {
+    close();
+    fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0) return false;
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);  // Local only
+    addr.sin_port = htons(port);
+
+    socklen_t len = sizeof(addr);
+    if (::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0 ||
+        ::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL, 0) | O_NONBLOCK) != 0) {
+        close();
+        return false;
+    }
+    port_ = ntohs(addr.sin_port);
+    return true;
+}
+
+template <typename Clock>
+void UdpTransport<Clock>::close() {
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+    port_ = 0;
+}
+
+template <typename Clock>
+void UdpTransport<Clock>::sendNow(uint32_t to, const std::vector<uint8_t>& bytes) {
+    if (fd_ < 0 || HEADER_BYTES + bytes.size() > MAX_DATAGRAM) return;
+
+    scratch_.resize(HEADER_BYTES + bytes.size());
+    std::memcpy(scratch_.data(), &peer_, HEADER_BYTES);
+    if (!bytes.empty()) std::memcpy(scratch_.data() + HEADER_BYTES, bytes.data(), bytes.size());
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(peerPorts_[to]);
+    // A full socket buffer is just another lost packet
+    ::sendto(fd_, scratch_.data(), scratch_.size(), 0, reinterpret_cast<sockaddr*>(&addr),
+             sizeof(addr));
+}
+
+template <typename Clock>
+bool UdpTransport<Clock>::receive(Packet& out) {
+    flush();
+    if (fd_ < 0) return false;
+
+    uint8_t buffer[MAX_DATAGRAM];
+    while (true) {
+        ssize_t received = ::recv(fd_, buffer, sizeof(buffer), 0);
+        if (received < 0) return false;  // EAGAIN: nothing waiting
+        if (static_cast<size_t>(received) < HEADER_BYTES) continue;  // Not ours
+
+        std::memcpy(&out.from, buffer, HEADER_BYTES);
+        out.bytes.assign(buffer + HEADER_BYTES, buffer + received);
+        return true;
+    }
+}
+
+#else
+
+template <typename Clock>
+bool UdpTransport<Clock>::open(uint16_t) { return false; }
+
+template <typename Clock>
+void UdpTransport<Clock>::close() {}
+
+template <typename Clock>
+void UdpTransport<Clock>::sendNow(uint32_t, const std::vector<uint8_t>&) {}
+
+template <typename Clock>
+bool UdpTransport<Clock>::receive(Packet&) { return false; }
+
+#endif  // UDP_TRANSPORT_POSIX
+#endif  // UDP_TRANSPORT_HPP
@@ -0,0 +1,191 @@
+// BatchRunner.hpp - Many Independent Simulations Stepped in Lockstep
+// ============================================================================
+// PURPOSE: Parameter sweeps and Monte Carlo runs. Instead of one simulation
+// owned by main.cpp, run thousands of independent DemoSimulation instances
+// with no window, spread over a ThreadPool, and aggregate their results.
+//
+// DATA LAYOUT:
+// The per-instance loop clocks (accumulator, tick, time scale, dropped time)
+// are stored structure-of-arrays — one vector per field — rather than one
+// GameLoop object per instance. Stepping a chunk of instances walks each
+// array linearly, and neighbouring instances never share a GameLoop-sized
+// object across threads.
+//
+// LOCKSTEP:
+// stepFrame() advances every instance by the same frame time before
+// returning, so all instances are always on the same frame. Within a frame,
+// each instance runs as many fixed updates as its own accumulator allows
+// (instances with a higher time scale run more ticks).
+//
+
+#ifndef BATCH_RUNNER_HPP
+#define BATCH_RUNNER_HPP
+#include <algorithm>  // for std::min, std::max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <memory>
+#include <vector>
+
+#include "../core/GameLoop.hpp"
+#include "../core/StateHash.hpp"
+#include "../core/ThreadPool.hpp"
+#include "../core/Timer.hpp"
+#include "DemoSimulation.hpp"
+
+struct BatchConfig {
+    size_t instances = 1000;
+    size_t particlesPerInstance = 256;
+    uint64_t baseSeed = 1;                   // Instance i uses seed baseSeed + i
+    float minTimeScale = 1.0f;               // Time scale is swept linearly
+    float maxTimeScale = 1.0f;               // from min (first) to max (last)
+    double frameSeconds = 1.0 / 60.0;        // Virtual frame time (no window, no vsync)
+    double fixedDt = GameLoop::DEFAULT_FIXED_DT;
+    unsigned threads = 0;                    // 0 = one per core
+    size_t grain = 8;                        // Instances per work chunk
+};
+
+struct BatchInstanceResult {
+    uint64_t seed = 0;
+    float timeScale = 1.0f;
+    uint64_t ticks = 0;
+    uint64_t kicks = 0;
+    double averageHeight = 0.0;
+    uint64_t stateHash = 0;
+};
+
+struct BatchReport {
+    size_t instances = 0;
+    unsigned threads = 0;
+    uint64_t frames = 0;
+    uint64_t totalTicks = 0;
+    double wallSeconds = 0.0;
+    double ticksPerSecond = 0.0;    // Summed over all instances
+    double meanHeight = 0.0;
+    double minHeight = 0.0;
+    double maxHeight = 0.0;
+    uint64_t combinedHash = 0;      // Same for any thread count if deterministic
+    std::vector<BatchInstanceResult> results;
+};
+
+class BatchRunner {
+public:
+    explicit BatchRunner(const BatchConfig& config) : config_(config), pool_(config.threads) {
+        size_t n = config.instances;
+        accumulator_.assign(n, 0.0);
+        tick_.assign(n, 0);
+        droppedTime_.assign(n, 0.0);
+        timeScale_.resize(n);
+        sims_.resize(n);
+
+        pool_.parallelFor(n, config_.grain, [this, n](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                float t = n > 1 ? static_cast<float>(i) / static_cast<float>(n - 1) : 0.0f;
+                timeScale_[i] = config_.minTimeScale + (config_.maxTimeScale - config_.minTimeScale) * t;
+
+                DemoSimulationConfig simConfig;
+                simConfig.particles = config_.particlesPerInstance;
+                simConfig.seed = config_.baseSeed + i;
+                sims_[i] = std::make_unique<DemoSimulation>(simConfig);
+            }
+        });
+    }
+
+    // ========================================================================
+    // Stepping
+    // ========================================================================
+
+    // Advance every instance by one frame (same accumulator logic as GameLoop)
+    void stepFrame() {
+        double frame = std::min(config_.frameSeconds, GameLoop::MAX_FRAME_TIME);
+        double dropped = std::max(0.0, config_.frameSeconds - GameLoop::MAX_FRAME_TIME);
+        double dt = config_.fixedDt;
+
+        pool_.parallelFor(sims_.size(), config_.grain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                double acc = accumulator_[i] + frame * static_cast<double>(timeScale_[i]);
+                uint64_t ticks = tick_[i];
+                while (acc >= dt) {
+                    sims_[i]->fixedUpdate(dt);
+                    acc -= dt;
+                    ++ticks;
+                }
+                accumulator_[i] = acc;
+                tick_[i] = ticks;
+                droppedTime_[i] += dropped;
+            }
+        });
+        ++frames_;
+    }
+
+    // Step `frames` frames and return the aggregated report
+    BatchReport run(uint64_t frames) {
+        Timer timer;
+        for (uint64_t f = 0; f < frames; ++f) stepFrame();
+        wallSeconds_ += timer.elapsed();
+        return report();
+    }
+
+    // ========================================================================
+    // Results
+    // ========================================================================
+
+    BatchReport report() {
+        BatchReport report;
+        report.instances = sims_.size();
+        report.threads = pool_.size();
+        report.frames = frames_;
+        report.wallSeconds = wallSeconds_;
+        report.results.resize(sims_.size());
+
+        // Gathering results touches every particle, so do it in parallel too
+        pool_.parallelFor(sims_.size(), config_.grain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                BatchInstanceResult& r = report.results[i];
+                r.seed = config_.baseSeed + i;
+                r.timeScale = timeScale_[i];
+                r.ticks = tick_[i];
+                r.kicks = sims_[i]->kicks();
+                r.averageHeight = sims_[i]->averageHeight();
+                r.stateHash = sims_[i]->stateHash();
+            }
+        });
+
+        if (report.results.empty()) return report;
+
+        StateHasher combined;
+        report.minHeight = report.results[0].averageHeight;
+        report.maxHeight = report.results[0].averageHeight;
+        double heightSum = 0.0;
+        for (const BatchInstanceResult& r : report.results) {
+            report.totalTicks += r.ticks;
+            heightSum += r.averageHeight;
+            report.minHeight = std::min(report.minHeight, r.averageHeight);
+            report.maxHeight = std::max(report.maxHeight, r.averageHeight);
+            combined.updateValue(r.stateHash);
+        }
+        report.meanHeight = heightSum / static_cast<double>(report.results.size());
+        report.combinedHash = combined.digest();
+        if (wallSeconds_ > 0.0) {
+            report.ticksPerSecond = static_cast<double>(report.totalTicks) / wallSeconds_;
+        }
+        return report;
+    }
+
+    size_t instances() const { return sims_.size(); }
+    unsigned threads() const { return pool_.size(); }
+
+private:
+    BatchConfig config_;
+    ThreadPool pool_;
+
+    // Per-instance loop clocks, structure-of-arrays
+    std::vector<double> accumulator_;
+    std::vector<uint64_t> tick_;
+    std::vector<float> timeScale_;
+    std::vector<double> droppedTime_;
+
+    std::vector<std::unique_ptr<DemoSimulation>> sims_;
+    uint64_t frames_ = 0;
+    double wallSeconds_ = 0.0;
+};
+#endif  // BATCH_RUNNER_HPP
@@ -0,0 +1,178 @@
+// DemoSimulation.hpp - Small Deterministic Simulation for Tooling and Tests
+// ============================================================================
+// PURPOSE: Give the loop tooling (hash logs, desync checks, benchmarks)
+// something real to simulate until the entity system lands:
+// - N particles under gravity bouncing in a box (structure-of-arrays floats)
+// - A seeded RNG (xorshift64*)
+// - A TimingWheel that fires random "kick" events a few ticks in the future
+//
+// Everything is deterministic for a given seed. The particle integration can
+// be split across threads; each particle only touches its own data, so the
+// result is bit-identical for any thread count — which is exactly what the
+// desync checker verifies.
+//
+
+#ifndef DEMO_SIMULATION_HPP
+#define DEMO_SIMULATION_HPP
+#include <algorithm>  // for std::max
+#include <array>
+#include <cmath>    // for std::nextafter
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../core/StateHash.hpp"
+#include "../core/ThreadPool.hpp"
+#include "../core/TimingWheel.hpp"
+
+struct DemoSimulationConfig {
+    size_t particles = 10000;
+    uint64_t seed = 1;
+    unsigned threads = 1;        // Threads used for the particle integration
+    uint64_t perturbAtTick = 0;  // Debug: nudge one particle by 1 ulp at this tick (0 = never)
+};
+
+class DemoSimulation {
+public:
+    // Names for the per-subsystem hashes written by hashState()
+    static constexpr std::array<const char*, 3> SUBSYSTEMS = {"particles", "rng", "timers"};
+
+    static std::vector<std::string> subsystemNames() {
+        return {SUBSYSTEMS.begin(), SUBSYSTEMS.end()};
+    }
+
+    explicit DemoSimulation(const DemoSimulationConfig& config)
+        : config_(config), rng_(config.seed * 0x9E3779B97F4A7C15ULL + 1) {
+        x_.resize(config.particles);
+        y_.resize(config.particles);
+        vx_.resize(config.particles);
+        vy_.resize(config.particles);
+        // Workers live as long as the simulation: creating threads every
+        // tick would cost more than the integration they split
+        if (config.threads > 1) pool_ = std::make_unique<ThreadPool>(config.threads);
+        for (size_t i = 0; i < config.particles; ++i) {
+            x_[i] = randomFloat() * WORLD_SIZE;
+            y_[i] = randomFloat() * WORLD_SIZE;
+            vx_[i] = randomFloat() * 20.0f - 10.0f;
+            vy_[i] = randomFloat() * 20.0f - 10.0f;
+        }
+    }
+
+    // Non-copyable: pending timer callbacks point back at this instance
+    DemoSimulation(const DemoSimulation&) = delete;
+    DemoSimulation& operator=(const DemoSimulation&) = delete;
+
+    // ========================================================================
+    // One Fixed Tick
+    // ========================================================================
+
+    void fixedUpdate(double dt) {
+        ++tick_;
+        float step = static_cast<float>(dt);
+
+        size_t count = x_.size();
+        if (!pool_) {
+            integrate(0, count, step);
+        } else {
+            // Chunks are handed out dynamically, but each particle only
+            // touches its own data, so the split never changes the result
+            size_t grain = std::max<size_t>(1024, count / (pool_->size() * 4));
+            pool_->parallelFor(count, grain, [this, step](size_t begin, size_t end) { integrate(begin, end, step); });
+        }
+
+        // Occasionally schedule a kick 1..120 ticks out
+        if ((nextRandom() & 7) == 0 && count > 0) {
+            timers_.schedule(1 + nextRandom() % 120, [this]() { kickRandomParticle(); });
+        }
+        timers_.advance();
+
+        if (tick_ == config_.perturbAtTick && count > 0) {
+            x_[0] = std::nextafter(x_[0], WORLD_SIZE);
+        }
+    }
+
+    // ========================================================================
+    // State Hashing
+    // ========================================================================
+
+    // Writes one hash per entry in SUBSYSTEMS
+    void hashState(std::span<uint64_t, SUBSYSTEMS.size()> out) const {
+        StateHasher particles;
+        particles.update(std::span<const float>(x_));
+        particles.update(std::span<const float>(y_));
+        particles.update(std::span<const float>(vx_));
+        particles.update(std::span<const float>(vy_));
+        out[0] = particles.digest();
+
+        out[1] = StateHasher::hash(&rng_, sizeof(rng_));
+
+        StateHasher timers;
+        timers.updateValue(timers_.now());
+        timers.updateValue(static_cast<uint64_t>(timers_.size()));
+        timers.updateValue(kicks_);
+        out[2] = timers.digest();
+    }
+
+    // One combined fingerprint of everything above
+    uint64_t stateHash() const {
+        std::array<uint64_t, SUBSYSTEMS.size()> hashes{};
+        hashState(hashes);
+        return StateHasher::hash(hashes.data(), sizeof(hashes));
+    }
+
+    // Example observable for parameter sweeps: mean particle height
+    double averageHeight() const {
+        double sum = 0.0;
+        for (float y : y_) sum += static_cast<double>(y);
+        return y_.empty() ? 0.0 : sum / static_cast<double>(y_.size());
+    }
+
+    uint64_t tick() const { return tick_; }
+    uint64_t kicks() const { return kicks_; }
+    size_t particleCount() const { return x_.size(); }
+
+private:
+    static constexpr float WORLD_SIZE = 1000.0f;
+    static constexpr float GRAVITY = -9.81f;
+
+    void integrate(size_t begin, size_t end, float dt) {
+        for (size_t i = begin; i < end; ++i) {
+            vy_[i] += GRAVITY * dt;
+            x_[i] += vx_[i] * dt;
+            y_[i] += vy_[i] * dt;
+
+            // Bounce off the walls of the box
+            if (x_[i] < 0.0f || x_[i] > WORLD_SIZE) vx_[i] = -vx_[i];
+            if (y_[i] < 0.0f || y_[i] > WORLD_SIZE) vy_[i] = -vy_[i];
+        }
+    }
+
+    void kickRandomParticle() {
+        size_t i = static_cast<size_t>(nextRandom() % x_.size());
+        vy_[i] += 25.0f;
+        ++kicks_;
+    }
+
+    // xorshift64* — tiny, fast, and identical on every platform
+    uint64_t nextRandom() {
+        rng_ ^= rng_ >> 12;
+        rng_ ^= rng_ << 25;
+        rng_ ^= rng_ >> 27;
+        return rng_ * 0x2545F4914F6CDD1DULL;
+    }
+
+    // Uniform in [0, 1) from the top 24 bits (exactly representable)
+    float randomFloat() { return static_cast<float>(nextRandom() >> 40) / 16777216.0f; }
+
+    DemoSimulationConfig config_;
+    std::vector<float> x_, y_, vx_, vy_;
+    uint64_t rng_;
+    uint64_t tick_ = 0;
+    uint64_t kicks_ = 0;
+    TimingWheel timers_;
+    std::unique_ptr<ThreadPool> pool_;  // Null when single-threaded
+};
+#endif  // DEMO_SIMULATION_HPP
@@ -0,0 +1,121 @@
+// RollbackDemo.hpp - Input-Driven Deterministic Game for Rollback Sessions
+// ============================================================================
+// PURPOSE: The smallest game that exercises rollback properly:
+// - One avatar per player, steered by a 4-bit input (left/right/up/down)
+// - N particles, each pulled toward one of the avatars, so a mispredicted
+//   input changes a lot of state and re-simulation has real work to do
+//
+// A rollback session needs three things from a game (see RollbackSession):
+//   saveState(State&), loadState(const State&), step(inputs)
+// plus checksum(State) for sync checks. State is plain vectors: saving into
+// an existing State reuses its capacity, so steady-state saves don't allocate.
+//
+
+#ifndef ROLLBACK_DEMO_HPP
+#define ROLLBACK_DEMO_HPP
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t
+#include <span>
+#include <vector>
+
+#include "../core/StateHash.hpp"
+
+struct RollbackDemoConfig {
+    uint32_t players = 2;
+    size_t particles = 10000;
+    uint64_t seed = 1;
+};
+
+class RollbackDemoGame {
+public:
+    // Input bits
+    static constexpr uint32_t LEFT = 1u << 0;
+    static constexpr uint32_t RIGHT = 1u << 1;
+    static constexpr uint32_t UP = 1u << 2;
+    static constexpr uint32_t DOWN = 1u << 3;
+
+    struct State {
+        uint32_t frame = 0;
+        std::vector<float> avatars;    // x, y, vx, vy per player
+        std::vector<float> particles;  // x, y, vx, vy per particle
+    };
+
+    explicit RollbackDemoGame(const RollbackDemoConfig& config) {
+        uint64_t rng = config.seed * 0x9E3779B97F4A7C15ULL + 1;
+        auto random = [&rng]() {
+            rng ^= rng >> 12;
+            rng ^= rng << 25;
+            rng ^= rng >> 27;
+            return static_cast<float>((rng * 0x2545F4914F6CDD1DULL) >> 40) / 16777216.0f;
+        };
+
+        state_.avatars.resize(size_t{config.players} * 4);
+        for (uint32_t p = 0; p < config.players; ++p) {
+            state_.avatars[p * 4 + 0] = WORLD_SIZE * static_cast<float>(p + 1) /
+                                        static_cast<float>(config.players + 1);
+            state_.avatars[p * 4 + 1] = WORLD_SIZE * 0.5f;
+        }
+        state_.particles.resize(config.particles * 4);
+        for (size_t i = 0; i < config.particles; ++i) {
+            state_.particles[i * 4 + 0] = random() * WORLD_SIZE;
+            state_.particles[i * 4 + 1] = random() * WORLD_SIZE;
+        }
+    }
+
+    // ========================================================================
+    // Rollback Interface
+    // ========================================================================
+
+    void saveState(State& out) const { out = state_; }
+    void loadState(const State& in) { state_ = in; }
+
+    // One fixed frame; inputs[p] is player p's input bits
+    void step(std::span<const uint32_t> inputs) {
+        ++state_.frame;
+        std::vector<float>& avatars = state_.avatars;
+        size_t players = avatars.size() / 4;
+
+        for (size_t p = 0; p < players && p < inputs.size(); ++p) {
+            float* a = &avatars[p * 4];
+            uint32_t input = inputs[p];
+            float ax = ((input & RIGHT) ? ACCELERATION : 0.0f) - ((input & LEFT) ? ACCELERATION : 0.0f);
+            float ay = ((input & UP) ? ACCELERATION : 0.0f) - ((input & DOWN) ? ACCELERATION : 0.0f);
+            a[2] = (a[2] + ax * DT) * DAMPING;
+            a[3] = (a[3] + ay * DT) * DAMPING;
+            a[0] += a[2] * DT;
+            a[1] += a[3] * DT;
+        }
+
+        if (players == 0) return;
+        std::vector<float>& particles = state_.particles;
+        size_t count = particles.size() / 4;
+        for (size_t i = 0; i < count; ++i) {
+            float* q = &particles[i * 4];
+            const float* target = &avatars[(i % players) * 4];
+            q[2] = (q[2] + (target[0] - q[0]) * PULL * DT) * DAMPING;
+            q[3] = (q[3] + (target[1] - q[1]) * PULL * DT) * DAMPING;
+            q[0] += q[2] * DT;
+            q[1] += q[3] * DT;
+        }
+    }
+
+    static uint64_t checksum(const State& state) {
+        StateHasher hasher;
+        hasher.updateValue(state.frame);
+        hasher.update(std::span<const float>(state.avatars));
+        hasher.update(std::span<const float>(state.particles));
+        return hasher.digest();
+    }
+
+    const State& state() const { return state_; }
+
+private:
+    static constexpr float WORLD_SIZE = 1000.0f;
+    static constexpr float DT = 1.0f / 60.0f;
+    static constexpr float ACCELERATION = 400.0f;
+    static constexpr float DAMPING = 0.98f;
+    static constexpr float PULL = 2.0f;
+
+    State state_;
+};
+#endif  // ROLLBACK_DEMO_HPP
@@ -0,0 +1,45 @@
+// ============================================================================
+// CommandLine.hpp - Tiny --name=value Flag Parsing for the Headless Tools
+// ============================================================================
+
+#ifndef COMMANDLINE_HPP
+#define COMMANDLINE_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace cli {
+
+// Returns the value of --name=VALUE, or nullptr if absent
+inline const char* findFlag(int argc, char* argv[], const char* name) {
+    size_t length = std::strlen(name);
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], name, length) == 0 && argv[i][length] == '=') {
+            return argv[i] + length + 1;
+        }
+    }
+    return nullptr;
+}
+
+// True if the bare switch --name is present
+inline bool hasSwitch(int argc, char* argv[], const char* name) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], name) == 0) return true;
+    }
+    return false;
+}
+
+inline uint64_t uintFlag(int argc, char* argv[], const char* name, uint64_t fallback) {
+    const char* value = findFlag(argc, argv, name);
+    return value ? std::strtoull(value, nullptr, 10) : fallback;
+}
+
+inline double doubleFlag(int argc, char* argv[], const char* name, double fallback) {
+    const char* value = findFlag(argc, argv, name);
+    return value ? std::strtod(value, nullptr) : fallback;
+}
+
+}  // namespace cli
+
+#endif // COMMANDLINE_HPP
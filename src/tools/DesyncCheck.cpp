@@ -0,0 +1,128 @@
+// ============================================================================
+// DesyncCheck.cpp - Run Two Simulations and Report the First Diverging Tick
+// ============================================================================
+//
+// Runs simulation A and simulation B side by side (one thread each), hashes
+// every subsystem after every fixed tick, then compares the hash logs.
+//
+// Usage:
+//   DesyncCheck [--ticks=N] [--particles=N] [--seed=N]
+//               [--threads-a=N] [--threads-b=N] [--perturb-b-at=TICK]
+//               [--write-log=PATH] [--compare-log=PATH]
+//
+// Examples:
+//   DesyncCheck --threads-a=1 --threads-b=8        # thread count must not matter
+//   DesyncCheck --write-log=release.hlog           # in one build...
+//   DesyncCheck --compare-log=release.hlog         # ...then compare from another
+//
+// A log records the --particles / --seed it ran with; --compare-log refuses
+// a reference recorded with others. Logs of different lengths (a cut-short
+// reference, another --ticks) count as a mismatch even where they agree.
+//
+// Exit code: 0 = identical, 1 = desync or length mismatch, 2 = usage / I/O
+// error or a reference from another configuration.
+//
+
+#include <fmt/core.h>
+
+#include <algorithm>  // for std::min
+#include <array>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "core/GameLoop.hpp"
+#include "core/HashLog.hpp"
+#include "core/Timer.hpp"
+#include "sim/DemoSimulation.hpp"
+#include "tools/CommandLine.hpp"
+
+namespace {
+
+// What two logs must share to be comparable (thread count must not matter,
+// so it isn't part of it)
+std::string configKey(const DemoSimulationConfig& config) {
+    return fmt::format("particles={} seed={}", config.particles, config.seed);
+}
+
+// Simulate `ticks` fixed updates and record a hash row after each one
+HashLog record(const DemoSimulationConfig& config, uint64_t ticks) {
+    DemoSimulation sim(config);
+    HashLog log(DemoSimulation::subsystemNames());
+    log.setConfig(configKey(config));
+    log.reserve(static_cast<size_t>(ticks));
+
+    std::array<uint64_t, DemoSimulation::SUBSYSTEMS.size()> hashes{};
+    for (uint64_t i = 0; i < ticks; ++i) {
+        sim.fixedUpdate(GameLoop::DEFAULT_FIXED_DT);
+        sim.hashState(hashes);
+        log.append(sim.tick(), hashes);
+    }
+    return log;
+}
+
+int report(const std::optional<Desync>& desync, const HashLog& a, const HashLog& b) {
+    if (desync) {
+        fmt::print("DESYNC at tick {} in subsystem '{}'\n", desync->tick, desync->subsystem);
+        return 1;
+    }
+    if (a.size() != b.size()) {
+        fmt::print("LENGTH MISMATCH: logs agree for {} ticks, but hold {} vs {}\n",
+                   std::min(a.size(), b.size()), a.size(), b.size());
+        return 1;
+    }
+    fmt::print("OK: {} ticks identical\n", a.size());
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint64_t ticks = cli::uintFlag(argc, argv, "--ticks", 3600);
+
+    DemoSimulationConfig configA;
+    configA.particles = static_cast<size_t>(cli::uintFlag(argc, argv, "--particles", 10000));
+    configA.seed = cli::uintFlag(argc, argv, "--seed", 1);
+    configA.threads = static_cast<unsigned>(cli::uintFlag(argc, argv, "--threads-a", 1));
+
+    DemoSimulationConfig configB = configA;
+    configB.threads = static_cast<unsigned>(cli::uintFlag(argc, argv, "--threads-b", 4));
+    configB.perturbAtTick = cli::uintFlag(argc, argv, "--perturb-b-at", 0);
+
+    const char* comparePath = cli::findFlag(argc, argv, "--compare-log");
+    const char* writePath = cli::findFlag(argc, argv, "--write-log");
+
+    Timer timer;
+
+    // Against a log from another build: only simulation A needs to run
+    if (comparePath) {
+        std::optional<HashLog> reference = HashLog::load(comparePath);
+        if (!reference) {
+            fmt::print(stderr, "Could not read hash log '{}'\n", comparePath);
+            return 2;
+        }
+        if (reference->config() != configKey(configA)) {
+            fmt::print(stderr, "Hash log '{}' was recorded with '{}', this run is '{}'\n", comparePath,
+                       reference->config(), configKey(configA));
+            return 2;
+        }
+        HashLog a = record(configA, ticks);
+        fmt::print("Simulated {} ticks in {:.2f} s\n", ticks, timer.elapsed());
+        return report(findFirstDesync(*reference, a), *reference, a);
+    }
+
+    // Two configurations in parallel
+    HashLog a(DemoSimulation::subsystemNames());
+    HashLog b(DemoSimulation::subsystemNames());
+    std::thread runB([&]() { b = record(configB, ticks); });
+    a = record(configA, ticks);
+    runB.join();
+    fmt::print("Simulated 2 x {} ticks in {:.2f} s (threads: {} vs {})\n", ticks, timer.elapsed(),
+               configA.threads, configB.threads);
+
+    if (writePath && !a.save(writePath)) {
+        fmt::print(stderr, "Could not write hash log '{}'\n", writePath);
+        return 2;
+    }
+    return report(findFirstDesync(a, b), a, b);
+}
@@ -0,0 +1,81 @@
+// ============================================================================
+// DrawDataSnapshot.hpp - Deep Copy of ImDrawData for Another Thread
+// ImGui::GetDrawData() points into buffers the next NewFrame() rewrites, so
+// a render thread can't draw from it while the main thread builds the next
+// frame. capture() copies the command lists into buffers this snapshot
+// owns; drawData() is what ImGui_ImplOpenGL3_RenderDrawData() takes.
+// ============================================================================
+//
+// Pooled: draw lists and their vertex/index/command vectors are kept and
+// only grow, so after the first few frames a capture is a few memcpys and
+// no allocation.
+//
+// Not copied: what the commands point at. Texture ids and user callbacks
+// (with their UserCallbackData) are used as-is on the render thread, so
+// they must stay valid until the frame is presented — true for the font
+// atlas and ImDrawCallback_ResetRenderState.
+//
+// ImGui 1.92+ (dynamic textures): RenderDrawData() also creates, uploads and
+// destroys textures from the live ImTextureData list, which NewFrame() and
+// EndFrame() on the main thread mutate at the same time. Snapshotting those
+// requests isn't implemented, so SUPPORTED is false there and main.cpp
+// stays single-threaded instead of racing on them.
+//
+
+#ifndef DRAW_DATA_SNAPSHOT_HPP
+#define DRAW_DATA_SNAPSHOT_HPP
+
+#include <imgui.h>
+
+#include <cstddef>  // for size_t
+#include <cstring>  // for std::memcpy
+#include <memory>
+#include <vector>
+
+class DrawDataSnapshot {
+public:
+    // False where a snapshot can't be drawn safely on another thread
+    static constexpr bool SUPPORTED = IMGUI_VERSION_NUM < 19200;
+
+    void capture(const ImDrawData& source) {
+        data_.Valid = source.Valid;
+        data_.CmdListsCount = source.CmdListsCount;
+        data_.TotalIdxCount = source.TotalIdxCount;
+        data_.TotalVtxCount = source.TotalVtxCount;
+        data_.DisplayPos = source.DisplayPos;
+        data_.DisplaySize = source.DisplaySize;
+        data_.FramebufferScale = source.FramebufferScale;
+        data_.OwnerViewport = source.OwnerViewport;
+#if IMGUI_VERSION_NUM >= 19200
+        data_.Textures = nullptr;  // Never hand the live texture list to another thread
+#endif
+
+        size_t count = static_cast<size_t>(source.CmdListsCount);
+        while (lists_.size() < count) lists_.push_back(std::make_unique<ImDrawList>(nullptr));
+        data_.CmdLists.resize(source.CmdListsCount);
+        for (size_t i = 0; i < count; ++i) {
+            const ImDrawList& from = *source.CmdLists[static_cast<int>(i)];
+            ImDrawList& to = *lists_[i];
+            copyInto(to.CmdBuffer, from.CmdBuffer);
+            copyInto(to.IdxBuffer, from.IdxBuffer);
+            copyInto(to.VtxBuffer, from.VtxBuffer);
+            to.Flags = from.Flags;
+            data_.CmdLists[static_cast<int>(i)] = &to;
+        }
+    }
+
+    ImDrawData* drawData() { return &data_; }
+
+private:
+    // resize() keeps the capacity, unlike ImVector's operator= (which frees)
+    template <typename T>
+    static void copyInto(ImVector<T>& to, const ImVector<T>& from) {
+        to.resize(from.Size);
+        if (from.Size > 0) std::memcpy(to.Data, from.Data, static_cast<size_t>(from.Size) * sizeof(T));
+    }
+
+    ImDrawData data_;
+    std::vector<std::unique_ptr<ImDrawList>> lists_;
+};
+
+#endif // DRAW_DATA_SNAPSHOT_HPP
@@ -12,7 +12,7 @@ class MenuBar {
 public:
     // Render the menu bar
     // Takes references to bools so menu items can toggle application state
-    void render(bool& showDemo, bool& showSettings, bool& shouldQuit) {
+    void render(bool& showDemo, bool& showSettings, bool& showTiming, bool& shouldQuit) {
         // BeginMainMenuBar creates a menu bar at the top of the viewport
         if (ImGui::BeginMainMenuBar()) {
             
@@ -50,6 +50,7 @@ public:
                 // MenuItem with bool pointer: toggles the bool, shows checkmark when true
                 ImGui::MenuItem("Demo Window", nullptr, &showDemo);
                 ImGui::MenuItem("Settings", nullptr, &showSettings);
+                ImGui::MenuItem("Timing", nullptr, &showTiming);
                 
                 ImGui::EndMenu();
             }
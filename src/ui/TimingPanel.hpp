@@ -0,0 +1,259 @@
+// ============================================================================
+// TimingPanel.hpp - Loop Timing Debug Panel
+// Frame time graph (zoomable from 1 s to 24 h), simulation clock, and
+// pause/step/time scale/turbo controls for the fixed timestep loop, plus
+// how often turbo renders (RenderDecimator).
+// ============================================================================
+
+#ifndef TIMINGPANEL_HPP
+#define TIMINGPANEL_HPP
+
+#include <imgui.h>
+
+#include <algorithm>  // for std::min, std::max
+#include <cstddef>    // for size_t
+#include <cstdio>     // for std::snprintf
+
+#include "../core/FrameTimeHistory.hpp"
+#include "../core/GameLoop.hpp"
+#include "../core/InputQueue.hpp"
+#include "../core/PerfCounters.hpp"
+#include "../core/RenderDecimator.hpp"
+#include "../core/TimeController.hpp"
+
+class TimingPanel {
+public:
+
+    // Render the panel (call every rendered frame)
+    void render(bool& isOpen, TimeController& time, const GameLoop& loop,
+                const FrametimeHistory& history, const InputQueue& input,
+                const LatencyHistogram& submitToPresent, const PerfCounters& counters, const PerfZones& zones,
+                RenderDecimator& turboRender) {
+        if (!isOpen) return;
+
+        if (ImGui::Begin("Timing", &isOpen)) {
+            // ================================================================
+            // FRAME TIME
+            // ================================================================
+            float average = history.average();
+            ImGui::Text("Frame: %.2f ms (%.0f FPS)", static_cast<double>(average),
+                        average > 0.0f ? 1000.0 / static_cast<double>(average) : 0.0);
+            ImGui::Text("Min %.2f / Max %.2f ms", static_cast<double>(history.minimum()),
+                        static_cast<double>(history.maximum()));
+            renderFrametimeGraph(history);
+
+            ImGui::Separator();
+
+            // ================================================================
+            // SIMULATION CLOCK
+            // ================================================================
+            ImGui::Text("Tick: %llu", static_cast<unsigned long long>(loop.tick()));
+            ImGui::Text("Alpha: %.3f", loop.alpha());
+            ImGui::Text("Dropped: %.3f s", loop.droppedTime());
+            ImGui::Text("Speed: %.2fx real time", loop.speedMultiplier());
+
+            ImGui::Separator();
+
+            // ================================================================
+            // INPUT LATENCY
+            // ================================================================
+            renderLatency("Input -> tick", input.inputToTick());
+            renderLatency("Input -> present", input.inputToPresent());
+            if (submitToPresent.count() > 0) {
+                // Render thread: the frame(s) queued between UI and screen
+                renderLatency("Submit -> present", submitToPresent);
+            }
+            if (input.dropped() > 0) {
+                ImGui::Text("Dropped events: %llu", static_cast<unsigned long long>(input.dropped()));
+            }
+
+            ImGui::Separator();
+
+            // ================================================================
+            // HARDWARE COUNTERS (last second, per sample)
+            // ================================================================
+            if (counters.available()) {
+                renderCounters(counters, zones);
+                ImGui::Separator();
+            } else if (!counters.error().empty()) {
+                ImGui::TextWrapped("Counters: %s", counters.error().c_str());
+                ImGui::Separator();
+            }
+
+            // ================================================================
+            // CONTROLS
+            // ================================================================
+            if (ImGui::Button(time.isPaused() ? "Resume" : "Pause")) {
+                time.togglePause();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Step")) {
+                time.step();
+            }
+
+            float scale = time.getTimeScale();
+            if (ImGui::SliderFloat("Time Scale", &scale, 0.1f, 5.0f, "%.2fx")) {
+                time.setTimeScale(scale);
+            }
+
+            // Label follows the limits below; the ### id keeps it one widget
+            char label[96];
+            turboLabel(label, sizeof(label), turboRender);
+            bool turbo = time.isTurbo();
+            if (ImGui::Checkbox(label, &turbo)) {
+                time.setTurbo(turbo);
+            }
+
+            // Turbo render limits (a frame renders when both allow it)
+            int everyNth = static_cast<int>(turboRender.everyNthFrame());
+            if (ImGui::InputInt("Render every Nth", &everyNth)) {
+                turboRender.setEveryNthFrame(static_cast<unsigned>(std::max(everyNth, 0)));
+            }
+            float rate = static_cast<float>(turboRender.maxRate());
+            if (ImGui::SliderFloat("Render rate", &rate, 0.0f, 60.0f, rate > 0.0f ? "%.0f Hz" : "unlimited")) {
+                turboRender.setMaxRate(static_cast<double>(rate));
+            }
+        }
+        ImGui::End();
+    }
+
+private:
+    // e.g. "Turbo (uncapped, render 1 in 4 frames, max 10 Hz)"
+    static void turboLabel(char* out, size_t size, const RenderDecimator& render) {
+        unsigned everyNth = render.everyNthFrame();
+        double rate = render.maxRate();
+        if (everyNth > 1 && rate > 0.0) {
+            std::snprintf(out, size, "Turbo (uncapped, render 1 in %u frames, max %.0f Hz)###turbo", everyNth,
+                          rate);
+        } else if (everyNth > 1) {
+            std::snprintf(out, size, "Turbo (uncapped, render 1 in %u frames)###turbo", everyNth);
+        } else if (rate > 0.0) {
+            std::snprintf(out, size, "Turbo (uncapped, render max %.0f Hz)###turbo", rate);
+        } else {
+            std::snprintf(out, size, "Turbo (uncapped, render every frame)###turbo");
+        }
+    }
+
+    static void renderLatency(const char* label, const LatencyHistogram& latency) {
+        ImGui::Text("%s: p50 %.2f / p99 %.2f / max %.2f ms (%llu)", label, latency.percentile(0.50),
+                    latency.percentile(0.99), latency.maximum(),
+                    static_cast<unsigned long long>(latency.count()));
+    }
+
+    static void renderCounters(const PerfCounters& counters, const PerfZones& zones) {
+        if (!ImGui::BeginTable("##counters", 6, ImGuiTableFlags_SizingFixedFit)) return;
+        ImGui::TableSetupColumn("zone");
+        ImGui::TableSetupColumn("IPC");
+        ImGui::TableSetupColumn("LLC miss");
+        ImGui::TableSetupColumn("br miss");
+        ImGui::TableSetupColumn("ctx sw");
+        ImGui::TableSetupColumn("n");
+        ImGui::TableHeadersRow();
+
+        for (size_t z = 0; z < zones.size(); ++z) {
+            const PerfStats& stats = zones.last(z);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(zones.name(z));
+            ImGui::TableNextColumn();
+            if (counters.has(PerfCounter::Cycles) && counters.has(PerfCounter::Instructions)) {
+                ImGui::Text("%.2f", stats.ipc());
+            } else {
+                ImGui::TextUnformatted("-");
+            }
+            for (PerfCounter counter : {PerfCounter::LlcMisses, PerfCounter::BranchMisses,
+                                        PerfCounter::ContextSwitches}) {
+                ImGui::TableNextColumn();
+                if (counters.has(counter)) {
+                    ImGui::Text("%.1f", stats.perSample(counter));
+                } else {
+                    ImGui::TextUnformatted("-");
+                }
+            }
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.samples));
+        }
+        ImGui::EndTable();
+    }
+
+    // Graph time spans, from raw frames up to the 10 min buckets
+    static constexpr const char* ZOOM_LABELS[] = {"1 s", "2 s (raw)", "1 min", "5 min",
+                                                   "1 h", "2 h", "24 h"};
+    static constexpr const char* STAT_LABELS[] = {"Max", "P99", "Avg", "Min"};
+
+    struct ZoomLevel {
+        int level;            // -1 = raw samples, else FrametimeLevels level
+        float windowSeconds;  // How far back the graph reaches
+    };
+    static constexpr ZoomLevel ZOOMS[] = {{-1, 1.0f},  {-1, 2.0f},   {0, 60.0f},   {0, 300.0f},
+                                          {1, 3600.0f}, {1, 7200.0f}, {2, 86400.0f}};
+
+    // What PlotLines' getter needs to read buckets in place (no copy, no rescan)
+    struct BucketView {
+        const FrametimeLevels* levels;
+        size_t level;
+        size_t first;  // Index of the oldest bucket shown
+        int stat;
+    };
+
+    static float bucketValue(void* data, int i) {
+        const BucketView& view = *static_cast<const BucketView*>(data);
+        const FrametimeBucket& b =
+            view.levels->bucket(view.level, view.first + static_cast<size_t>(i));
+        switch (view.stat) {
+            case 0: return b.maximum;
+            case 1: return b.p99;
+            case 2: return b.average;
+            default: return b.minimum;
+        }
+    }
+
+    struct RawView {
+        const FrametimeHistory* history;
+        size_t count;
+    };
+
+    static float rawValue(void* data, int i) {
+        const RawView& view = *static_cast<const RawView*>(data);
+        return view.history->recent(view.count, static_cast<size_t>(i));
+    }
+
+    void renderFrametimeGraph(const FrametimeHistory& history) {
+        ImGui::SetNextItemWidth(90.0f);
+        ImGui::Combo("Span", &zoom_, ZOOM_LABELS, IM_ARRAYSIZE(ZOOM_LABELS));
+        const ZoomLevel& zoom = ZOOMS[zoom_];
+        if (zoom.level >= 0) {
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(70.0f);
+            ImGui::Combo("Stat", &stat_, STAT_LABELS, IM_ARRAYSIZE(STAT_LABELS));
+        }
+
+        const ImVec2 size(0, 80);
+        if (zoom.level < 0) {
+            RawView view{&history, history.samplesWithin(zoom.windowSeconds * 1000.0f)};
+            ImGui::PlotLines("##frametimes", rawValue, &view, static_cast<int>(view.count), 0,
+                             nullptr, 0.0f, 50.0f, size);
+            return;
+        }
+
+        const FrametimeLevels& levels = history.levels();
+        size_t level = static_cast<size_t>(zoom.level);
+        size_t wanted = static_cast<size_t>(
+            static_cast<double>(zoom.windowSeconds) / FrametimeLevels::BUCKET_SECONDS[level]);
+        size_t shown = std::min(wanted, levels.count(level));
+        if (shown == 0) {
+            ImGui::TextDisabled("Collecting... (first %.0f s bucket not closed yet)",
+                                FrametimeLevels::BUCKET_SECONDS[level]);
+            return;
+        }
+
+        BucketView view{&levels, level, levels.count(level) - shown, stat_};
+        ImGui::PlotLines("##frametime_levels", bucketValue, &view, static_cast<int>(shown), 0,
+                         nullptr, 0.0f, 50.0f, size);
+    }
+
+    int zoom_ = 1;  // Default: the raw 2 s view
+    int stat_ = 0;
+};
+
+#endif // TIMINGPANEL_HPP
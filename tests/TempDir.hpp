@@ -0,0 +1,48 @@
+// TempDir.hpp - Per-Test Scratch Directory
+// ============================================================================
+// PURPOSE: A directory under the system temp dir for tests that write files,
+// removed again when the test ends. The name comes from the running test and
+// the process id, so tests run in parallel (ctest -j runs each test in its
+// own process) never share or delete each other's files.
+//
+
+#ifndef TESTS_TEMP_DIR_HPP
+#define TESTS_TEMP_DIR_HPP
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#if defined(_WIN32)
+#include <process.h>
+#define TEMP_DIR_GETPID _getpid
+#else
+#include <unistd.h>
+#define TEMP_DIR_GETPID getpid
+#endif
+
+struct TempDir {
+    std::filesystem::path path;
+
+    TempDir() : path(std::filesystem::temp_directory_path() / uniqueName()) {
+        std::filesystem::remove_all(path);
+    }
+    ~TempDir() {
+        std::error_code error;  // Never throw from a destructor
+        std::filesystem::remove_all(path, error);
+    }
+
+    // Non-copyable (the destructor removes the directory)
+    TempDir(const TempDir&) = delete;
+    TempDir& operator=(const TempDir&) = delete;
+
+private:
+    static std::string uniqueName() {
+        const ::testing::TestInfo* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string name = test ? std::string(test->test_suite_name()) + "_" + test->name() : "test";
+        return name + "_" + std::to_string(TEMP_DIR_GETPID());
+    }
+};
+
+#undef TEMP_DIR_GETPID
+#endif  // TESTS_TEMP_DIR_HPP
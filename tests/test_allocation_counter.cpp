@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include "core/AllocationCounter.hpp"
+
+namespace {
+
+struct alignas(64) CacheLine {
+    uint64_t values[8];
+};
+
+}  // namespace
+
+TEST(AllocationCounterTest, CountsPlainAllocations) {
+    uint64_t allocations = allocation_counter::allocations();
+    uint64_t deallocations = allocation_counter::deallocations();
+    auto value = std::make_unique<uint64_t>(7);
+    EXPECT_EQ(allocation_counter::allocations(), allocations + 1);
+    value.reset();
+    EXPECT_EQ(allocation_counter::deallocations(), deallocations + 1);
+}
+
+// Aligned new doesn't go through the plain operator new in libstdc++: it
+// has to be counted on its own (World allocates its chunks this way).
+// Operator calls rather than new-expressions, which the compiler may elide.
+TEST(AllocationCounterTest, CountsOverAlignedAllocations) {
+    uint64_t allocations = allocation_counter::allocations();
+    uint64_t deallocations = allocation_counter::deallocations();
+
+    void* chunk = ::operator new(1000, std::align_val_t{64});
+    void* lines = ::operator new[](4 * sizeof(CacheLine), std::align_val_t{alignof(CacheLine)});
+    void* nothrow = ::operator new(24, std::align_val_t{32}, std::nothrow);
+    uint64_t allocated = allocation_counter::allocations() - allocations;
+    bool aligned = reinterpret_cast<uintptr_t>(chunk) % 64 == 0 &&
+                   reinterpret_cast<uintptr_t>(lines) % alignof(CacheLine) == 0;
+
+    ::operator delete(chunk, 1000, std::align_val_t{64});
+    ::operator delete[](lines, std::align_val_t{alignof(CacheLine)});
+    ::operator delete(nothrow, std::align_val_t{32}, std::nothrow);
+    uint64_t deallocated = allocation_counter::deallocations() - deallocations;
+
+    EXPECT_TRUE(aligned);
+    EXPECT_EQ(allocated, 3u);
+    EXPECT_EQ(deallocated, 3u);
+}
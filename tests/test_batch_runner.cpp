@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "core/ThreadPool.hpp"
+#include "sim/BatchRunner.hpp"
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(10007);
+
+    for (int round = 0; round < 50; ++round) {
+        pool.parallelFor(visits.size(), 13, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) visits[i].fetch_add(1);
+        });
+    }
+
+    for (const std::atomic<int>& v : visits) ASSERT_EQ(v.load(), 50);
+}
+
+TEST(BatchRunnerTest, ResultsDoNotDependOnThreadCount) {
+    BatchConfig config;
+    config.instances = 64;
+    config.particlesPerInstance = 32;
+    config.minTimeScale = 0.5f;
+    config.maxTimeScale = 2.0f;
+
+    config.threads = 1;
+    BatchReport single = BatchRunner(config).run(120);
+    config.threads = 4;
+    BatchReport quad = BatchRunner(config).run(120);
+
+    EXPECT_EQ(single.combinedHash, quad.combinedHash);
+    EXPECT_EQ(single.totalTicks, quad.totalTicks);
+    EXPECT_EQ(quad.threads, 4u);
+}
+
+TEST(BatchRunnerTest, TimeScaleSweepRunsMoreTicksAtHigherScale) {
+    BatchConfig config;
+    config.instances = 3;
+    config.particlesPerInstance = 8;
+    config.minTimeScale = 1.0f;
+    config.maxTimeScale = 3.0f;
+    config.threads = 2;
+
+    BatchReport report = BatchRunner(config).run(60);
+
+    ASSERT_EQ(report.results.size(), 3u);
+    EXPECT_NEAR(static_cast<double>(report.results[0].ticks), 60.0, 1.0);
+    EXPECT_NEAR(static_cast<double>(report.results[1].ticks), 120.0, 1.0);
+    EXPECT_NEAR(static_cast<double>(report.results[2].ticks), 180.0, 1.0);
+}
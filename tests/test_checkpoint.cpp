@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "core/Checkpoint.hpp"
+#include "core/GameLoop.hpp"
+#include "core/VirtualClock.hpp"
+#include "TempDir.hpp"
+
+namespace {
+
+struct Player {
+    float x = 0.0f;
+    float y = 0.0f;
+    int32_t health = 100;
+};
+
+// Stand-in simulation: a POD struct, an RNG stream and a growing array
+struct TestState {
+    Player player;
+    uint64_t rng = 0x9E3779B97F4A7C15ULL + 1;
+    std::vector<float> heights;
+
+    void tick() {
+        rng ^= rng >> 12;
+        rng ^= rng << 25;
+        rng ^= rng >> 27;
+        player.x += static_cast<float>(rng % 7);
+        heights.push_back(player.x);
+    }
+};
+
+void registerState(Checkpointer& checkpoints, TestState& state) {
+    ASSERT_TRUE(checkpoints.addValue("player", state.player));
+    ASSERT_TRUE(checkpoints.addValue("rng", state.rng));
+    ASSERT_TRUE(checkpoints.addVector("heights", state.heights));
+}
+
+}  // namespace
+
+TEST(CheckpointTest, ResumesTheLoopWhereItLeftOff) {
+    TempDir dir;
+    std::string path = (dir.path / "session.ckpt").string();
+    VirtualClock::reset();
+
+    // Original run: 300 ticks at 1.3x, checkpoint, then 400 more frames
+    TimeController time;
+    BasicGameLoop<VirtualClock> loop(time);
+    TestState state;
+    Checkpointer checkpoints;
+    registerState(checkpoints, state);
+    time.setTimeScale(1.3f);
+    while (loop.tick() < 300) loop.advance(0.007, [&](double) { state.tick(); });
+
+    ASSERT_TRUE(checkpoints.save(path, captureLoopState(loop, time)));
+    checkpoints.waitForWrites();
+    EXPECT_EQ(checkpoints.savesWritten(), 1u);
+    for (int frame = 0; frame < 400; ++frame) loop.advance(0.007, [&](double) { state.tick(); });
+
+    // Resumed run: fresh objects, loaded from the file
+    TimeController resumedTime;
+    BasicGameLoop<VirtualClock> resumedLoop(resumedTime);
+    TestState resumed;
+    Checkpointer resumedCheckpoints;
+    registerState(resumedCheckpoints, resumed);
+    CheckpointFile file;
+    ASSERT_TRUE(file.open(path)) << file.error();
+    EXPECT_TRUE(file.verify());
+    ASSERT_TRUE(restoreLoopState(file.loop(), resumedLoop, resumedTime));
+    ASSERT_TRUE(resumedCheckpoints.restore(file)) << resumedCheckpoints.error();
+    EXPECT_EQ(resumedLoop.tick(), file.loop().tick);
+    EXPECT_FLOAT_EQ(resumedTime.getTimeScale(), 1.3f);
+    for (int frame = 0; frame < 400; ++frame) resumedLoop.advance(0.007, [&](double) { resumed.tick(); });
+
+    // Same frames from the same state: bit-identical
+    EXPECT_EQ(resumedLoop.tick(), loop.tick());
+    EXPECT_EQ(resumedLoop.accumulator(), loop.accumulator());
+    EXPECT_EQ(resumed.rng, state.rng);
+    EXPECT_EQ(resumed.player.x, state.player.x);
+    EXPECT_EQ(resumed.heights, state.heights);
+}
+
+TEST(CheckpointTest, BlocksArePageAlignedSpansIntoTheFile) {
+    TempDir dir;
+    std::string path = (dir.path / "layout.ckpt").string();
+    TestState state;
+    for (int i = 0; i < 5000; ++i) state.tick();
+    Checkpointer checkpoints;
+    registerState(checkpoints, state);
+    ASSERT_TRUE(checkpoints.save(path, {}));
+    checkpoints.waitForWrites();
+
+    CheckpointFile file;
+    ASSERT_TRUE(file.open(path)) << file.error();
+    ASSERT_EQ(file.blockCount(), 3u);
+    EXPECT_EQ(file.blockName(0), "player");
+    EXPECT_EQ(file.blockName(2), "heights");
+    EXPECT_EQ(file.fileBytes() % checkpoint_detail::ALIGNMENT, 0u);
+    EXPECT_EQ(std::filesystem::file_size(path), file.fileBytes());
+
+    auto heights = file.block("heights");
+    ASSERT_TRUE(heights.has_value());
+    EXPECT_EQ(heights->size(), state.heights.size() * sizeof(float));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(heights->data()) % checkpoint_detail::ALIGNMENT, 0u);
+    EXPECT_EQ(std::memcmp(heights->data(), state.heights.data(), heights->size()), 0);
+    EXPECT_FALSE(file.block("missing").has_value());
+}
+
+TEST(CheckpointTest, SaveSnapshotsStateBeforeReturning) {
+    TempDir dir;
+    std::string path = (dir.path / "snapshot.ckpt").string();
+    std::vector<uint64_t> big(1 << 20, 7);
+    Checkpointer checkpoints;
+    ASSERT_TRUE(checkpoints.addVector("big", big));
+
+    ASSERT_TRUE(checkpoints.save(path, {}));
+    EXPECT_GT(checkpoints.lastSnapshotSeconds(), 0.0);  // 8 MiB copied on this thread
+    // The writer may still be busy: this save is either dropped or written
+    bool second = checkpoints.save(path + ".2", {});
+    std::fill(big.begin(), big.end(), 9);  // Changes after save() don't reach the file
+    checkpoints.waitForWrites();
+    EXPECT_EQ(checkpoints.savesWritten() + checkpoints.savesDropped(), 2u);
+    EXPECT_EQ(checkpoints.savesDropped(), second ? 0u : 1u);
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+
+    Checkpointer loader;
+    std::vector<uint64_t> loaded;
+    ASSERT_TRUE(loader.addVector("big", loaded));
+    CheckpointFile file;
+    ASSERT_TRUE(file.open(path)) << file.error();
+    ASSERT_TRUE(loader.restore(file));
+    ASSERT_EQ(loaded.size(), big.size());
+    EXPECT_EQ(loaded.front(), 7u);
+    EXPECT_EQ(loaded.back(), 7u);
+}
+
+TEST(CheckpointTest, RejectsBadFilesAndLeavesStateUntouched) {
+    TempDir dir;
+    std::string path = (dir.path / "bad.ckpt").string();
+    TestState state;
+    state.tick();
+    Checkpointer checkpoints;
+    registerState(checkpoints, state);
+    ASSERT_TRUE(checkpoints.save(path, {}));
+    checkpoints.waitForWrites();
+
+    CheckpointFile file;
+    EXPECT_FALSE(file.open((dir.path / "nope.ckpt").string()));
+    EXPECT_FALSE(file.error().empty());
+
+    // A block the loader expects with a different size: nothing restored
+    struct BiggerPlayer {
+        Player player;
+        float z = 0.0f;
+    } bigger;
+    uint64_t rng = 42;
+    Checkpointer mismatched;
+    ASSERT_TRUE(mismatched.addValue("rng", rng));
+    ASSERT_TRUE(mismatched.addValue("player", bigger));
+    ASSERT_TRUE(file.open(path));
+    EXPECT_FALSE(mismatched.restore(file));
+    EXPECT_NE(mismatched.error().find("player"), std::string::npos);
+    EXPECT_EQ(rng, 42u);
+
+    // Duplicate and over-long names are refused at registration
+    EXPECT_FALSE(mismatched.addValue("rng", rng));
+    EXPECT_FALSE(mismatched.addValue(std::string(48, 'n'), rng));
+
+    // Another fixed timestep: ticks would mean a different amount of time
+    TimeController time;
+    BasicGameLoop<VirtualClock> loop(time, 1.0 / 30.0);
+    CheckpointLoopState other;
+    other.fixedDt = 1.0 / 60.0;
+    other.tick = 99;
+    EXPECT_FALSE(restoreLoopState(other, loop, time));
+    EXPECT_EQ(loop.tick(), 0u);
+    file.close();
+
+    // Flipped payload byte: opens (no contents check) but fails verify()
+    {
+        std::fstream raw(path, std::ios::in | std::ios::out | std::ios::binary);
+        raw.seekp(static_cast<std::streamoff>(checkpoint_detail::ALIGNMENT) + 1);
+        raw.put('\x7f');
+    }
+    ASSERT_TRUE(file.open(path));
+    EXPECT_FALSE(file.verify());
+    file.close();
+
+    // Truncated and wrong-version files don't open at all
+    std::filesystem::resize_file(path, checkpoint_detail::ALIGNMENT);
+    EXPECT_FALSE(file.open(path));
+    {
+        std::fstream raw(path, std::ios::in | std::ios::out | std::ios::binary);
+        raw.seekp(8);
+        uint32_t version = checkpoint_detail::VERSION + 1;
+        raw.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    }
+    EXPECT_FALSE(file.open(path));
+    EXPECT_NE(file.error().find("version"), std::string::npos);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/RenderInterpolation.hpp"
+#include "ecs/CommandBuffer.hpp"
+#include "ecs/World.hpp"
+
+namespace {
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Health {
+    int32_t value;
+};
+
+size_t countWith(World& world) {
+    size_t n = 0;
+    world.forEachChunk<Position>([&n](size_t count, Position*) { n += count; });
+    return n;
+}
+
+}  // namespace
+
+TEST(EcsTest, CreateDestroyAndStaleHandles) {
+    World world;
+    Entity a = world.create(Position{1, 2});
+    Entity b = world.create(Position{3, 4});
+    EXPECT_EQ(world.size(), 2u);
+
+    world.destroy(a);
+    EXPECT_FALSE(world.alive(a));
+    EXPECT_EQ(world.get<Position>(a), nullptr);
+    EXPECT_EQ(world.get<Position>(b)->x, 3.0f);
+
+    // The index is reused with a new generation; the old handle stays dead
+    Entity c = world.create(Position{5, 6});
+    EXPECT_EQ(c.index, a.index);
+    EXPECT_NE(c.generation, a.generation);
+    EXPECT_FALSE(world.alive(a));
+    EXPECT_TRUE(world.alive(c));
+    world.destroy(a);  // Stale: no effect on c
+    EXPECT_TRUE(world.alive(c));
+}
+
+TEST(EcsTest, AddRemoveKeepsOtherComponents) {
+    World world;
+    Entity e = world.create(Position{1, 2});
+    world.add(e, Velocity{3, 4});
+    world.add(e, Health{100});
+    ASSERT_TRUE(world.has<Velocity>(e));
+    EXPECT_EQ(world.get<Position>(e)->y, 2.0f);
+    EXPECT_EQ(world.get<Velocity>(e)->x, 3.0f);
+
+    world.remove<Velocity>(e);
+    EXPECT_FALSE(world.has<Velocity>(e));
+    EXPECT_EQ(world.get<Position>(e)->x, 1.0f);
+    EXPECT_EQ(world.get<Health>(e)->value, 100);
+
+    world.add(e, Health{50});  // Already present: overwrite in place
+    EXPECT_EQ(world.get<Health>(e)->value, 50);
+}
+
+TEST(EcsTest, QueriesMatchEverySuperset) {
+    World world;
+    for (int i = 0; i < 10; ++i) world.create(Position{0, 0});
+    for (int i = 0; i < 20; ++i) world.create(Position{0, 0}, Velocity{1, 0});
+    for (int i = 0; i < 30; ++i) world.create(Position{0, 0}, Velocity{1, 0}, Health{1});
+    world.create(Velocity{1, 0});
+
+    EXPECT_EQ(countWith(world), 60u);
+
+    world.forEachChunk<Position, const Velocity>([](size_t n, Position* p, const Velocity* v) {
+        for (size_t i = 0; i < n; ++i) p[i].x += v[i].x;
+    });
+    size_t moved = 0;
+    world.each<Position>([&moved](Entity, Position& p) { moved += p.x == 1.0f; });
+    EXPECT_EQ(moved, 50u);
+}
+
+TEST(EcsTest, ChunksFitAndStayDenseAfterSwapRemove) {
+    World world;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 5000; ++i) {
+        entities.push_back(world.create(Position{static_cast<float>(i), 0}, Velocity{0, 0}));
+    }
+    const Archetype* archetype = nullptr;
+    for (size_t i = 0; i < world.archetypeCount(); ++i) {
+        if (world.archetype(i).size() == 5000) archetype = &world.archetype(i);
+    }
+    ASSERT_NE(archetype, nullptr);
+    // 8 (entity) + 8 + 8 bytes per row, minus a cache line of padding per array
+    EXPECT_GE(archetype->capacity(), 600u);
+    EXPECT_LE(archetype->capacity() * 24, Archetype::CHUNK_BYTES);
+    EXPECT_EQ(archetype->chunkCount(), (5000 + archetype->capacity() - 1) / archetype->capacity());
+
+    // Destroy every other entity: survivors keep their data and handles
+    for (size_t i = 0; i < entities.size(); i += 2) world.destroy(entities[i]);
+    for (size_t i = 1; i < entities.size(); i += 2) {
+        ASSERT_TRUE(world.alive(entities[i]));
+        EXPECT_EQ(world.get<Position>(entities[i])->x, static_cast<float>(i));
+    }
+    EXPECT_EQ(archetype->size(), 2500u);
+    EXPECT_EQ(archetype->chunkCount(), (2500 + archetype->capacity() - 1) / archetype->capacity());
+}
+
+TEST(EcsTest, CommandsAreInvisibleUntilApplied) {
+    World world;
+    CommandBuffer commands;
+    Entity doomed = world.create(Position{0, 0}, Health{0});
+    Entity keeper = world.create(Position{0, 0}, Health{10});
+
+    world.each<Health>([&](Entity e, Health& h) {
+        if (h.value <= 0) commands.destroy(e);
+        Entity spawned = commands.create(world);
+        commands.add(spawned, Position{9, 9});
+        commands.add(e, Velocity{1, 1});
+    });
+    EXPECT_EQ(world.size(), 2u);
+    EXPECT_EQ(countWith(world), 2u);
+    EXPECT_FALSE(world.has<Velocity>(keeper));
+
+    commands.apply(world);
+    EXPECT_TRUE(commands.empty());
+    EXPECT_FALSE(world.alive(doomed));  // Add to a destroyed entity is skipped
+    EXPECT_TRUE(world.has<Velocity>(keeper));
+    EXPECT_EQ(world.size(), 3u);
+    EXPECT_EQ(countWith(world), 3u);
+
+    // Discarded creates hand their index back
+    Entity never = commands.create(world);
+    commands.discard(world);
+    EXPECT_FALSE(world.alive(never));
+    EXPECT_EQ(world.create().index, never.index);
+}
+
+TEST(EcsTest, ByteRangesHashIdenticallyBuiltWorlds) {
+    auto build = [](World& world, float nudge) {
+        CommandBuffer commands;
+        for (int i = 0; i < 1000; ++i) {
+            Entity e = world.create(Position{static_cast<float>(i), nudge});
+            if (i % 3 == 0) commands.add(e, Velocity{1, 0});
+            if (i % 7 == 0) commands.destroy(e);
+        }
+        commands.apply(world);
+    };
+    World a, b, c;
+    build(a, 0.0f);
+    build(b, 0.0f);
+    build(c, 0.5f);
+    EXPECT_EQ(a.stateHash(), b.stateHash());
+    EXPECT_NE(a.stateHash(), c.stateHash());
+
+    size_t positionBytes = 0;
+    a.forEachByteRange([&](ComponentId id, std::span<const std::byte> bytes) {
+        if (id == componentId<Position>()) positionBytes += bytes.size();
+    });
+    EXPECT_EQ(positionBytes, a.size() * sizeof(Position));
+}
+
+TEST(EcsTest, ColumnsInterpolateAsFlatFloats) {
+    World previous, current;
+    for (int i = 0; i < 100; ++i) {
+        previous.create(Position{0, 0});
+        current.create(Position{static_cast<float>(i), 2});
+    }
+    // Same build order, same layout: blend chunk by chunk
+    std::vector<const float*> from;
+    previous.forEachChunk<const Position>([&](size_t, const Position* p) {
+        from.push_back(reinterpret_cast<const float*>(p));
+    });
+    std::vector<Position> out(100);
+    size_t written = 0, chunk = 0;
+    current.forEachChunk<const Position>([&](size_t n, const Position* p) {
+        bestInterpolationKernels().lerp(from[chunk++], reinterpret_cast<const float*>(p),
+                                        reinterpret_cast<float*>(out.data() + written), n * 2, 0.5f);
+        written += n;
+    });
+    ASSERT_EQ(written, 100u);
+    EXPECT_FLOAT_EQ(out[10].x, 5.0f);
+    EXPECT_FLOAT_EQ(out[10].y, 1.0f);
+}
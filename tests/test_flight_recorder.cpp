@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include "core/FlightRecorder.hpp"
+#include "core/FrameTimeHistory.hpp"
+#include "TempDir.hpp"
+
+namespace {
+
+FlightRecorderConfig testConfig(const TempDir& dir) {
+    FlightRecorderConfig config;
+    config.frames = 32;
+    config.zones = 16;
+    config.inputs = 8;
+    config.warmupFrames = 10;
+    config.cooldownSeconds = 1.0;
+    config.directory = dir.path.string();
+    return config;
+}
+
+// Push one frame through history + recorder the way Application::update does
+bool frame(FlightRecorder& recorder, FrametimeHistory& history, double seconds) {
+    bool queued = recorder.endFrame(seconds, 1, history.median());
+    history.push(static_cast<float>(seconds * 1000.0));
+    return queued;
+}
+
+}  // namespace
+
+TEST(FlightRecorderTest, MedianIgnoresSpikes) {
+    FrametimeHistory history;
+    for (int i = 0; i < 20; ++i) history.push(16.0f);
+    history.push(500.0f);
+    EXPECT_FLOAT_EQ(history.median(), 16.0f);
+    EXPECT_GT(history.average(), 30.0f);
+}
+
+TEST(FlightRecorderTest, HitchWritesReadableDump) {
+    TempDir dir;
+    FrametimeHistory history;
+    FlightRecorder recorder(testConfig(dir));
+
+    for (int i = 0; i < 40; ++i) {
+        recorder.recordPhase(FramePhase::Update, 0.004);
+        recorder.recordZone("fixedUpdate", 0.002);
+        if (i == 35) recorder.recordInput(65, 1, 0);
+        EXPECT_FALSE(frame(recorder, history, 1.0 / 60.0));
+    }
+    recorder.setDirectory((dir.path / "moved").string());  // Applies to later dumps
+    recorder.recordZone("slowThing", 0.080);
+    EXPECT_TRUE(frame(recorder, history, 0.1));  // 6x the median
+
+    std::vector<std::string> files = recorder.waitForWrites();
+    ASSERT_EQ(files.size(), 1u);
+    // Named by session, so the next run's frame 40 doesn't overwrite it
+    EXPECT_EQ(std::filesystem::path(files[0]).parent_path(), dir.path / "moved");
+    EXPECT_EQ(std::filesystem::path(files[0]).filename().string(), "hitch_" + recorder.session() + "_40.flr");
+
+    std::optional<FlightDump> dump = FlightRecorder::load(files[0]);
+    ASSERT_TRUE(dump);
+    EXPECT_EQ(dump->hitchFrame, 40u);
+    EXPECT_NEAR(dump->hitchMs, 100.0f, 1e-3f);
+    EXPECT_NEAR(dump->medianMs, 1000.0f / 60.0f, 1e-3f);
+
+    // Rings keep only the newest entries, oldest first, hitch frame last
+    ASSERT_EQ(dump->frames.size(), 32u);
+    EXPECT_EQ(dump->frames.back().frame, 40u);
+    EXPECT_NEAR(dump->frames.front().phaseMs[static_cast<size_t>(FramePhase::Update)], 4.0f, 1e-3f);
+
+    ASSERT_EQ(dump->zones.size(), 16u);
+    EXPECT_EQ(dump->zoneNames[dump->zones.back().second], "slowThing");
+    EXPECT_EQ(dump->zoneNames[dump->zones.front().second], "fixedUpdate");
+
+    ASSERT_EQ(dump->inputs.size(), 1u);
+    EXPECT_EQ(dump->inputs[0].frame, 35u);
+    EXPECT_EQ(dump->inputs[0].key, 65);
+}
+
+TEST(FlightRecorderTest, HitchStormIsRateLimited) {
+    TempDir dir;
+    FrametimeHistory history;
+    FlightRecorderConfig config = testConfig(dir);
+    config.maxDumps = 2;
+    FlightRecorder recorder(config);
+
+    for (int i = 0; i < 20; ++i) frame(recorder, history, 1.0 / 60.0);
+
+    // Alternate hitches with normal frames for ~10 s of sim time
+    int queued = 0;
+    for (int i = 0; i < 200; ++i) {
+        queued += frame(recorder, history, i % 2 == 0 ? 0.1 : 1.0 / 60.0) ? 1 : 0;
+        recorder.waitForWrites();  // Writer never busy: only cooldown/limit apply
+    }
+    EXPECT_EQ(queued, 2);
+    EXPECT_EQ(recorder.waitForWrites().size(), 2u);
+}
+
+TEST(FlightRecorderTest, NoTriggerDuringWarmupOrBelowFloor) {
+    TempDir dir;
+    FrametimeHistory history;
+    FlightRecorder recorder(testConfig(dir));
+
+    // Spike before warm-up: the median doesn't mean anything yet
+    frame(recorder, history, 1.0 / 60.0);
+    EXPECT_FALSE(frame(recorder, history, 0.5));
+
+    // 1 ms -> 5 ms is 5x, but below the 8 ms floor
+    for (int i = 0; i < 30; ++i) frame(recorder, history, 0.001);
+    EXPECT_FALSE(frame(recorder, history, 0.005));
+    EXPECT_TRUE(recorder.waitForWrites().empty());
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include "core/FrameTimeHistory.hpp"
+#include "core/FrametimeLevels.hpp"
+
+TEST(FrametimeLevelsTest, OneSecondBucketsSummarizeFrames) {
+    FrametimeLevels levels;
+    // 2 seconds at 10 ms/frame, with one 50 ms hitch in the second second
+    for (int i = 0; i < 100; ++i) levels.push(10.0f);
+    for (int i = 0; i < 96; ++i) levels.push(i == 40 ? 50.0f : 10.0f);
+
+    ASSERT_EQ(levels.count(0), 2u);
+    const FrametimeBucket& first = levels.bucket(0, 0);
+    EXPECT_FLOAT_EQ(first.minimum, 10.0f);
+    EXPECT_FLOAT_EQ(first.maximum, 10.0f);
+    EXPECT_NEAR(first.average, 10.0f, 1e-4f);
+    EXPECT_FLOAT_EQ(first.p99, 10.0f);  // Clamped into [min, max]
+
+    const FrametimeBucket& second = levels.bucket(0, 1);
+    EXPECT_FLOAT_EQ(second.maximum, 50.0f);
+    EXPECT_GT(second.average, 10.0f);
+    EXPECT_EQ(levels.count(1), 0u);
+}
+
+TEST(FrametimeLevelsTest, P99TracksSlowTail) {
+    FrametimeLevels levels;
+    // 1000 frames of 1 ms: 980 fast, 20 at 8 ms -> p99 lands in the slow group
+    for (int i = 0; i < 1000; ++i) levels.push(i % 50 == 0 ? 8.0f : 0.5f);
+    while (levels.count(0) == 0) levels.push(0.5f);
+
+    float p99 = levels.bucket(0, 0).p99;
+    EXPECT_GT(p99, 7.0f);
+    EXPECT_LE(p99, 8.0f);
+}
+
+TEST(FrametimeLevelsTest, CoarseLevelsRollUpAndMemoryIsFixed) {
+    FrametimeLevels levels;
+    // 25 hours at 100 ms/frame: far more than the 24 h the top level holds
+    const int frames = 25 * 3600 * 10;
+    for (int i = 0; i < frames; ++i) levels.push(100.0f);
+
+    EXPECT_EQ(levels.count(0), FrametimeLevels::CAPACITY[0]);
+    EXPECT_EQ(levels.count(1), FrametimeLevels::CAPACITY[1]);
+    EXPECT_EQ(levels.count(2), FrametimeLevels::CAPACITY[2]);
+    EXPECT_NEAR(levels.bucket(2, 143).average, 100.0f, 1e-3f);
+    EXPECT_LT(sizeof(FrametimeLevels), size_t{32} * 1024);
+}
+
+TEST(FrametimeLevelsTest, LongStallClosesOneBucket) {
+    FrametimeLevels levels;
+    levels.push(5000.0f);  // Debugger break
+    EXPECT_EQ(levels.count(0), 1u);
+    EXPECT_FLOAT_EQ(levels.bucket(0, 0).maximum, 5000.0f);
+
+    // The stall isn't replayed: the next short frame doesn't close another bucket
+    levels.push(16.0f);
+    EXPECT_EQ(levels.count(0), 1u);
+}
+
+TEST(FrametimeLevelsTest, HistoryFeedsLevelsAndFindsRecentWindow) {
+    FrametimeHistory history;
+    for (int i = 0; i < 100; ++i) history.push(20.0f);
+    EXPECT_EQ(history.levels().count(0), 2u);
+    EXPECT_EQ(history.samplesWithin(1000.0f), 50u);
+    EXPECT_FLOAT_EQ(history.recent(50, 49), 20.0f);
+
+    history.clear();
+    EXPECT_EQ(history.levels().count(0), 0u);
+}
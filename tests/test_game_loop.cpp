@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include "core/GameLoop.hpp"
+#include "core/RenderDecimator.hpp"
+
+namespace {
+auto noop = [](double) {};
+}
+
+TEST(GameLoopTest, SpiralOfDeathCapDropsExcessTime) {
+    TimeController time;
+    GameLoop loop(time);
+
+    int ticks = loop.advance(1.0, noop);
+
+    EXPECT_EQ(ticks, 15);  // 0.25 s cap at 60 Hz
+    EXPECT_NEAR(loop.droppedTime(), 0.75, 1e-9);
+}
+
+TEST(GameLoopTest, TurboRunsFlatOutForTheSlice) {
+    TimeController time;
+    time.setTurbo(true);
+    GameLoop loop(time);
+
+    int ticks = loop.advanceTurbo(0.0, 0.002, noop);
+
+    // A no-op update is far cheaper than 1/60 s, so 2 ms buys many ticks
+    EXPECT_GT(ticks, 100);
+    EXPECT_EQ(loop.tick(), static_cast<uint64_t>(ticks));
+    EXPECT_EQ(loop.alpha(), 0.0);
+    EXPECT_EQ(loop.droppedTime(), 0.0);
+}
+
+TEST(GameLoopTest, TurboRespectsPauseAndStep) {
+    TimeController time;
+    time.setTurbo(true);
+    time.pause();
+    GameLoop loop(time);
+
+    EXPECT_EQ(loop.advanceTurbo(0.0, 0.002, noop), 0);
+    time.step();
+    EXPECT_EQ(loop.advanceTurbo(0.0, 0.002, noop), 1);
+}
+
+TEST(GameLoopTest, LeavingTurboDoesNotReplayTheLastSlice) {
+    TimeController time;
+    GameLoop loop(time);
+    loop.advanceTurbo(0.0, 0.001, noop);
+    uint64_t ticksAfterTurbo = loop.tick();
+
+    // This frame time covers the turbo slice + render; it must not be banked
+    EXPECT_EQ(loop.advance(0.2, noop), 0);
+    EXPECT_EQ(loop.tick(), ticksAfterTurbo);
+
+    // Normal pacing from then on
+    EXPECT_EQ(loop.advance(GameLoop::DEFAULT_FIXED_DT * 2.5, noop), 2);
+}
+
+TEST(GameLoopTest, SpeedMultiplierTracksTimeScale) {
+    TimeController time;
+    time.setTimeScale(0.5f);
+    GameLoop loop(time);
+
+    for (int i = 0; i < 120; ++i) loop.advance(GameLoop::DEFAULT_FIXED_DT, noop);
+
+    EXPECT_NEAR(loop.speedMultiplier(), 0.5, 0.05);
+}
+
+TEST(RenderDecimatorTest, LimitsToWallClockRate) {
+    RenderDecimator decimator;
+    decimator.setMaxRate(10.0);
+
+    int rendered = 0;
+    for (int i = 0; i < 600; ++i) rendered += decimator.shouldRender(1.0 / 600.0);
+
+    EXPECT_NEAR(rendered, 10, 1);  // One second of frames at 10 Hz
+}
+
+TEST(RenderDecimatorTest, EveryNthFrame) {
+    RenderDecimator decimator;
+    decimator.setMaxRate(0.0);
+    decimator.setEveryNthFrame(4);
+
+    int rendered = 0;
+    for (int i = 0; i < 40; ++i) rendered += decimator.shouldRender(0.001);
+
+    EXPECT_EQ(rendered, 10);
+}
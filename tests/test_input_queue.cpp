@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "core/GameLoop.hpp"
+#include "core/InputQueue.hpp"
+#include "core/LatencyHistogram.hpp"
+#include "core/SpscQueue.hpp"
+#include "core/VirtualClock.hpp"
+
+namespace {
+
+using VirtualInputQueue = BasicInputQueue<VirtualClock>;
+
+// Application::update() in miniature: each tick takes the input whose
+// timestamp falls inside its window; returns the tick each event landed in
+struct Harness {
+    TimeController time;
+    BasicGameLoop<VirtualClock> loop{time};
+    VirtualInputQueue input;
+    std::vector<uint64_t> deliveredAtTick;  // Indexed by event code
+
+    Harness() { VirtualClock::reset(); }
+
+    // Advance the clock to `seconds`, pushing events stamped along the way
+    void pushAt(double seconds, int code) {
+        VirtualClock::advanceSeconds(seconds - VirtualInputQueue::now());
+        input.push(InputDevice::Key, code, 1, 0);
+    }
+
+    void frameAt(double seconds, double frameSeconds) {
+        VirtualClock::advanceSeconds(seconds - VirtualInputQueue::now());
+        double frameTime = VirtualInputQueue::now();
+        loop.advance(frameSeconds, [&](double dt) {
+            double end = tickWindowEnd(frameTime, loop.accumulator(), dt, time.getTimeScale());
+            input.deliverUntil(end, [&](const InputEvent& event) {
+                size_t code = static_cast<size_t>(event.code);
+                if (deliveredAtTick.size() <= code) deliveredAtTick.resize(code + 1, UINT64_MAX);
+                deliveredAtTick[code] = loop.tick();
+            });
+        });
+    }
+};
+
+}  // namespace
+
+TEST(InputQueueTest, EachEventGoesToTheTickWhoseWindowContainsIt) {
+    Harness h;
+    // 40 ms frames at 60 Hz: frame 1 runs ticks 0-1 (covering 0-33.3 ms);
+    // frame 2 runs ticks 2-3 (33.3-66.7 ms), 13.3 ms stays banked
+    h.pushAt(0.005, 0);
+    h.pushAt(0.020, 1);
+    h.pushAt(0.035, 2);
+    h.frameAt(0.040, 0.040);
+    EXPECT_EQ(h.input.pending(), 1u);  // 35 ms is past this frame's last tick
+
+    h.pushAt(0.060, 3);
+    h.pushAt(0.070, 4);
+    h.frameAt(0.080, 0.040);
+    EXPECT_EQ(h.input.pending(), 1u);  // 70 ms belongs to tick 4
+
+    h.frameAt(0.120, 0.040);
+
+    ASSERT_EQ(h.deliveredAtTick.size(), 5u);
+    EXPECT_EQ(h.deliveredAtTick[0], 0u);
+    EXPECT_EQ(h.deliveredAtTick[1], 1u);
+    EXPECT_EQ(h.deliveredAtTick[2], 2u);
+    EXPECT_EQ(h.deliveredAtTick[3], 3u);
+    EXPECT_EQ(h.deliveredAtTick[4], 4u);
+}
+
+TEST(InputQueueTest, RecordsInputToTickAndInputToPresentLatency) {
+    VirtualClock::reset();
+    VirtualInputQueue input;
+    input.push(InputDevice::MouseButton, 0, 1, 0);
+    VirtualClock::advanceSeconds(0.004);
+    input.push(InputDevice::MouseButton, 0, 0, 0);
+    VirtualClock::advanceSeconds(0.006);
+
+    size_t delivered = input.deliverUntil(VirtualInputQueue::now(), [](const InputEvent&) {});
+    EXPECT_EQ(delivered, 2u);
+    VirtualClock::advanceSeconds(0.010);
+    input.markPresented();
+
+    // Tick: 10 ms and 6 ms after the events; present: 20 ms and 16 ms
+    EXPECT_EQ(input.inputToTick().count(), 2u);
+    EXPECT_NEAR(input.inputToTick().maximum(), 10.0, 1e-6);
+    EXPECT_NEAR(input.inputToTick().minimum(), 6.0, 1e-6);
+    EXPECT_NEAR(input.inputToPresent().maximum(), 20.0, 1e-6);
+    EXPECT_NEAR(input.inputToPresent().mean(), 18.0, 1e-6);
+
+    // Presenting again adds nothing new
+    input.markPresented();
+    EXPECT_EQ(input.inputToPresent().count(), 2u);
+}
+
+TEST(InputQueueTest, FullQueueDropsNewestAndCounts) {
+    VirtualClock::reset();
+    VirtualInputQueue input;
+    for (size_t i = 0; i < VirtualInputQueue::CAPACITY; ++i) {
+        EXPECT_TRUE(input.push(InputDevice::Key, static_cast<int>(i), 1, 0));
+    }
+    EXPECT_FALSE(input.push(InputDevice::Key, -1, 1, 0));
+    EXPECT_EQ(input.dropped(), 1u);
+
+    VirtualClock::advanceSeconds(0.001);
+    EXPECT_EQ(input.discardUntil(VirtualInputQueue::now()), VirtualInputQueue::CAPACITY);
+    EXPECT_EQ(input.pending(), 0u);
+}
+
+TEST(InputQueueTest, LatencyHistogramPercentilesAreWithinABin) {
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 1000; ++i) histogram.add(static_cast<double>(i) * 0.01);  // 0.01..10 ms
+
+    EXPECT_EQ(histogram.count(), 1000u);
+    EXPECT_NEAR(histogram.mean(), 5.005, 1e-9);
+    EXPECT_NEAR(histogram.percentile(0.5), 5.0, 5.0 * 0.1);
+    EXPECT_NEAR(histogram.percentile(0.99), 9.9, 9.9 * 0.1);
+    EXPECT_DOUBLE_EQ(histogram.percentile(1.0), 10.0);
+}
+
+TEST(SpscQueueTest, DeliversEveryItemInOrderAcrossThreads) {
+    SpscQueue<uint64_t, 256> queue;
+    constexpr uint64_t ITEMS = 200000;
+
+    std::thread producer([&queue]() {
+        for (uint64_t i = 0; i < ITEMS; ++i) {
+            while (!queue.push(i)) std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    while (expected < ITEMS) {
+        uint64_t value = 0;
+        if (!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(value, expected);
+        ++expected;
+    }
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
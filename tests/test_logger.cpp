@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>  // for std::any_of
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/Logger.hpp"
+#include "TempDir.hpp"
+
+namespace {
+
+LoggerConfig testConfig(const TempDir& dir) {
+    LoggerConfig config;
+    config.path = (dir.path / "test.log").string();
+    config.consoleLevel = LogLevel::Off;  // Keep test output clean
+    return config;
+}
+
+std::vector<std::string> readLines(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);) lines.push_back(line);
+    return lines;
+}
+
+}  // namespace
+
+TEST(LoggerTest, FormatsArgumentsOnTheBackgroundThread) {
+    TempDir dir;
+    {
+        Logger logger(testConfig(dir));
+        Logger::setGlobal(&logger);
+
+        std::string name = "settings.json";
+        logWarn("Settings load error ({}): {}", name, "unexpected token");
+        name = "overwritten";  // The message kept its own copy
+        logInfo("tick {} took {:.2f} ms", uint64_t{42}, 1.5);
+        logDebug("no arguments");
+        logger.flush();
+        EXPECT_EQ(logger.written(), 3u);
+    }
+    EXPECT_EQ(Logger::global(), nullptr);  // Detached by the destructor
+
+    auto lines = readLines(dir.path / "test.log");
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_NE(lines[0].find("WARN "), std::string::npos);
+    EXPECT_NE(lines[0].find("Settings load error (settings.json): unexpected token"), std::string::npos);
+    EXPECT_NE(lines[1].find("tick 42 took 1.50 ms"), std::string::npos);
+    EXPECT_NE(lines[2].find("DEBUG"), std::string::npos);
+}
+
+TEST(LoggerTest, InterleavesThreadsByTimeAndLosesNothing) {
+    TempDir dir;
+    constexpr int THREADS = 4;
+    constexpr int MESSAGES = 5000;
+    {
+        Logger logger(testConfig(dir));
+        Logger::setGlobal(&logger);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([t]() {
+                for (int i = 0; i < MESSAGES; ++i) {
+                    logInfo("thread {} message {}", t, i);
+                    if (i % 256 == 0) std::this_thread::yield();
+                }
+            });
+        }
+        for (std::thread& thread : threads) thread.join();
+        logger.flush();
+        EXPECT_EQ(logger.written() + logger.dropped(), static_cast<uint64_t>(THREADS * MESSAGES));
+        EXPECT_EQ(logger.dropped(), 0u);
+    }
+
+    auto lines = readLines(dir.path / "test.log");
+    ASSERT_EQ(lines.size(), static_cast<size_t>(THREADS * MESSAGES));
+    // Per thread, messages stay in order
+    std::vector<int> next(THREADS, 0);
+    for (const std::string& line : lines) {
+        int thread = 0, message = 0;
+        size_t at = line.find("thread ");
+        ASSERT_NE(at, std::string::npos);
+        std::istringstream(line.substr(at + 7)) >> thread;
+        std::istringstream(line.substr(line.find("message ") + 8)) >> message;
+        EXPECT_EQ(message, next[static_cast<size_t>(thread)]++);
+    }
+}
+
+TEST(LoggerTest, ShortLivedThreadsRecycleRings) {
+    TempDir dir;
+    // Far more threads than MAX_THREADS, in waves of half that many alive
+    // at once: each exit retires its ring and a later thread takes it over
+    constexpr size_t WAVE = Logger::MAX_THREADS / 2;
+    constexpr size_t THREADS = WAVE * 16;
+    constexpr int MESSAGES = 20;
+    {
+        Logger logger(testConfig(dir));
+        Logger::setGlobal(&logger);
+        for (size_t first = 0; first < THREADS; first += WAVE) {
+            std::vector<std::thread> wave;
+            for (size_t t = first; t < first + WAVE; ++t) {
+                wave.emplace_back([t]() {
+                    for (int i = 0; i < MESSAGES; ++i) logInfo("thread {} message {}", t, i);
+                });
+            }
+            for (std::thread& thread : wave) thread.join();
+        }
+        logger.flush();
+        EXPECT_EQ(logger.dropped(), 0u);
+        EXPECT_EQ(logger.written(), THREADS * MESSAGES);
+    }
+
+    auto lines = readLines(dir.path / "test.log");
+    ASSERT_EQ(lines.size(), THREADS * MESSAGES);
+}
+
+TEST(LoggerTest, ThreadsPastMaxThreadsDropUntilARingRetires) {
+    TempDir dir;
+    Logger logger(testConfig(dir));
+
+    // Every ring held by a live thread
+    std::mutex mutex;
+    std::condition_variable changed;
+    size_t holding = 0;
+    bool release = false;
+    std::vector<std::thread> holders;
+    for (size_t t = 0; t < Logger::MAX_THREADS; ++t) {
+        holders.emplace_back([&, t]() {
+            logger.write(LogLevel::Info, "holder {}", t);
+            std::unique_lock<std::mutex> lock(mutex);
+            ++holding;
+            changed.notify_all();
+            changed.wait(lock, [&]() { return release; });
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&]() { return holding == Logger::MAX_THREADS; });
+    }
+
+    std::thread late([&]() {
+        // Refused once, then each message is a counted drop (no retry while
+        // nothing retires)
+        for (int i = 0; i < 1000; ++i) logger.write(LogLevel::Info, "late {}", i);
+        EXPECT_EQ(logger.dropped(), 1000u);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            release = true;
+        }
+        changed.notify_all();
+        for (std::thread& holder : holders) holder.join();
+
+        // A ring retired: the next message registers and gets through
+        logger.write(LogLevel::Info, "late {}", 1000);
+        logger.flush();
+        EXPECT_EQ(logger.dropped(), 1000u);
+    });
+    late.join();
+
+    EXPECT_EQ(logger.written(), Logger::MAX_THREADS + 1);
+    auto lines = readLines(dir.path / "test.log");
+    EXPECT_TRUE(std::any_of(lines.begin(), lines.end(),
+                            [](const std::string& line) { return line.ends_with("late 1000"); }));
+}
+
+TEST(LoggerTest, FullRingDropsInsteadOfBlocking) {
+    TempDir dir;
+    LoggerConfig config = testConfig(dir);
+    config.ringBytes = 4096;
+    config.flushIntervalSeconds = 10.0;  // The drain won't run until flush()
+    Logger logger(config);
+
+    std::string payload(100, 'x');
+    for (int i = 0; i < 1000; ++i) logger.write(LogLevel::Info, "{} {}", i, payload);
+    EXPECT_GT(logger.dropped(), 900u);
+    logger.flush();
+    EXPECT_EQ(logger.written() + logger.dropped(), 1000u);
+
+    // After draining there's room again
+    logger.write(LogLevel::Info, "after {}", 1);
+    logger.flush();
+    auto lines = readLines(dir.path / "test.log");
+    ASSERT_FALSE(lines.empty());
+    EXPECT_NE(lines.back().find("after 1"), std::string::npos);
+}
+
+TEST(LoggerTest, RotatesAndKeepsMaxFiles) {
+    TempDir dir;
+    LoggerConfig config = testConfig(dir);
+    config.maxFileBytes = 4096;
+    config.maxFiles = 3;
+    {
+        Logger logger(config);
+        for (int i = 0; i < 2000; ++i) {
+            logger.write(LogLevel::Info, "line {:06}", i);
+            if (i % 100 == 0) logger.flush();  // Several batches, several rotations
+        }
+    }
+    EXPECT_TRUE(std::filesystem::exists(dir.path / "test.log"));
+    EXPECT_TRUE(std::filesystem::exists(dir.path / "test.log.1"));
+    EXPECT_TRUE(std::filesystem::exists(dir.path / "test.log.2"));
+    EXPECT_FALSE(std::filesystem::exists(dir.path / "test.log.3"));
+
+    // The newest lines are in the current file
+    auto lines = readLines(dir.path / "test.log");
+    ASSERT_FALSE(lines.empty());
+    EXPECT_NE(lines.back().find("line 001999"), std::string::npos);
+}
+
+TEST(LoggerTest, LevelFilterDropsOnTheCallingThread) {
+    TempDir dir;
+    LoggerConfig config = testConfig(dir);
+    config.level = LogLevel::Warn;
+    Logger logger(config);
+    Logger::setGlobal(&logger);
+    logDebug("hidden {}", 1);
+    logInfo("hidden {}", 2);
+    logError("shown {}", 3);
+    logger.flush();
+    Logger::setGlobal(nullptr);
+    EXPECT_EQ(logger.written(), 1u);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>  // for std::max
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "core/LoopMetrics.hpp"
+#include "core/Timer.hpp"
+#include "core/TripleBuffer.hpp"
+#include "net/MetricsServer.hpp"
+
+TEST(TripleBufferTest, ReaderSeesLatestPublish) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.acquire());
+
+    buffer.publish(1);
+    buffer.publish(2);
+    EXPECT_TRUE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 2);  // 1 was skipped, never torn
+    EXPECT_FALSE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 2);
+}
+
+TEST(LoopMetricsTest, HistogramBucketsAreCumulativeInOutput) {
+    LoopMetricsSnapshot snapshot;
+    snapshot.frameTime.observe(0.0005);
+    snapshot.frameTime.observe(0.016);
+    snapshot.frameTime.observe(5.0);
+
+    std::string text = openmetrics::format(snapshot);
+
+    EXPECT_NE(text.find("loop_frame_time_seconds_bucket{le=\"0.001\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("loop_frame_time_seconds_bucket{le=\"0.0167\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("loop_frame_time_seconds_bucket{le=\"+Inf\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("loop_frame_time_seconds_count 3\n"), std::string::npos);
+    EXPECT_TRUE(text.ends_with("# EOF\n"));
+}
+
+// Scrape tests shell out to curl, like a Prometheus scrape would hit us
+#if defined(__unix__) || defined(__APPLE__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+// Run a shell command and capture stdout (used to scrape with curl)
+std::string run(const std::string& command) {
+    std::string out;
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) return out;
+    char buffer[512];
+    while (size_t n = fread(buffer, 1, sizeof(buffer), pipe)) out.append(buffer, n);
+    pclose(pipe);
+    return out;
+}
+
+bool haveCurl() { return std::system("curl --version > /dev/null 2>&1") == 0; }
+
+}  // namespace
+
+TEST(MetricsServerTest, CurlScrapeReturnsPublishedSnapshot) {
+    if (!haveCurl()) GTEST_SKIP() << "curl not installed";
+
+    MetricsServer server;
+    if (!server.start(0)) GTEST_SKIP() << "sockets unavailable";
+
+    LoopMetricsSnapshot snapshot;
+    snapshot.ticks = 1234;
+    snapshot.paused = true;
+    snapshot.droppedSeconds = 0.5;
+    server.publish(snapshot);
+
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port());
+    std::string body = run("curl -s -H 'Accept: application/openmetrics-text' " + url + "/metrics");
+
+    EXPECT_NE(body.find("loop_ticks_total 1234\n"), std::string::npos) << body;
+    EXPECT_NE(body.find("loop_paused 1\n"), std::string::npos);
+    EXPECT_NE(body.find("loop_dropped_time_seconds_total 0.5\n"), std::string::npos);
+    EXPECT_TRUE(body.ends_with("# EOF\n"));
+
+    std::string status = run("curl -s -o /dev/null -w '%{http_code}' " + url + "/nope");
+    EXPECT_EQ(status, "404");
+}
+
+TEST(MetricsServerTest, PublishNeverWaitsOnScrapes) {
+    if (!haveCurl()) GTEST_SKIP() << "curl not installed";
+
+    MetricsServer server;
+    if (!server.start(0)) GTEST_SKIP() << "sockets unavailable";
+
+    // A scraper that sends half a request and stalls: the server thread sits
+    // in that request for its full 1 s read timeout. The server is already
+    // blocked in poll() on the listening socket, so it accepts at once.
+    int stalled = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(stalled, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(server.port());
+    ASSERT_EQ(::connect(stalled, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    const char partial[] = "GET /metrics HTTP/1.1\r\n";
+    ASSERT_GT(::send(stalled, partial, sizeof(partial) - 1, 0), 0);
+
+    // Meanwhile the "frame loop" publishes flat out for 300 ms
+    LoopMetricsSnapshot snapshot;
+    double slowest = 0.0;
+    uint64_t published = 0;
+    Timer elapsed;
+    while (elapsed.elapsed() < 0.3) {
+        snapshot.ticks = published++;
+        Timer publish;
+        server.publish(snapshot);
+        slowest = std::max(slowest, publish.elapsed());
+    }
+    ::close(stalled);
+
+    // Waiting on the stuck request would take up to a second; the bound only
+    // leaves room for the scheduler preempting a publish on a busy machine
+    EXPECT_LT(slowest, 0.1) << "slowest publish " << slowest * 1000.0 << " ms";
+    EXPECT_GT(published, 1000u);
+
+    // The newest snapshot is what the next scrape sees
+    std::string url = "http://127.0.0.1:" + std::to_string(server.port()) + "/metrics";
+    std::string body = run("curl -s " + url);
+    EXPECT_NE(body.find("loop_ticks_total " + std::to_string(published - 1) + "\n"), std::string::npos) << body;
+}
+
+#endif  // curl scrape tests
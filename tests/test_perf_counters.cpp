@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/PerfCounters.hpp"
+
+TEST(PerfCountersTest, SampleArithmeticAndStats) {
+    PerfSample start, end;
+    start.values = {1000, 1500, 10, 20, 1};
+    end.values = {5000, 9500, 30, 60, 2};
+
+    PerfSample delta = end - start;
+    EXPECT_EQ(delta[PerfCounter::Cycles], 4000u);
+    EXPECT_EQ(delta[PerfCounter::Instructions], 8000u);
+
+    PerfStats stats;
+    stats.add(delta);
+    stats.add(delta);
+    EXPECT_EQ(stats.samples, 2u);
+    EXPECT_DOUBLE_EQ(stats.ipc(), 2.0);
+    EXPECT_DOUBLE_EQ(stats.perSample(PerfCounter::LlcMisses), 20.0);
+    EXPECT_DOUBLE_EQ(stats.perSample(PerfCounter::ContextSwitches), 1.0);
+
+    stats.clear();
+    EXPECT_EQ(stats.samples, 0u);
+    EXPECT_DOUBLE_EQ(stats.ipc(), 0.0);
+}
+
+TEST(PerfCountersTest, ZonesPublishOnRoll) {
+    PerfZones zones;
+    size_t frame = zones.add("frame");
+    size_t tick = zones.add("tick");
+    EXPECT_EQ(zones.size(), 2u);
+    EXPECT_STREQ(zones.name(tick), "tick");
+
+    PerfSample sample;
+    sample.values = {100, 200, 0, 0, 0};
+    zones.open(frame).add(sample);
+    EXPECT_EQ(zones.last(frame).samples, 0u);  // Nothing published yet
+
+    zones.roll();
+    EXPECT_EQ(zones.last(frame).samples, 1u);
+    EXPECT_EQ(zones.open(frame).samples, 0u);
+    EXPECT_DOUBLE_EQ(zones.last(frame).ipc(), 2.0);
+}
+
+// Whatever the machine allows (none in most containers and CI VMs), opening
+// must not fail loudly, and reads must be monotonic for what did open
+TEST(PerfCountersTest, OpensWhatIsPermittedAndFallsBackCleanly) {
+    PerfCounters counters;
+    bool opened = counters.open();
+    EXPECT_EQ(opened, counters.available());
+    if (!opened) {
+        EXPECT_FALSE(counters.error().empty());
+        PerfSample zero = counters.read();
+        for (uint64_t value : zero.values) EXPECT_EQ(value, 0u);
+        GTEST_SKIP() << "no counters: " << counters.error();
+    }
+
+    PerfStats stats;
+    {
+        PerfScope scope(counters, stats);
+        std::vector<uint64_t> work(1 << 16);
+        for (size_t i = 0; i < work.size(); ++i) work[i] = i * i;
+        volatile uint64_t sink = work[work.size() / 2];
+        (void)sink;
+    }
+    EXPECT_EQ(stats.samples, 1u);
+    if (counters.has(PerfCounter::Instructions)) {
+        EXPECT_GT(stats.total[PerfCounter::Instructions], 10000u);
+    }
+    if (counters.has(PerfCounter::Cycles)) {
+        EXPECT_GT(stats.total[PerfCounter::Cycles], 0u);
+    }
+
+    std::string summary = perfSummary(stats, counters, "zone");
+    EXPECT_NE(summary.find("per zone (1 samples)"), std::string::npos);
+
+    counters.close();
+    EXPECT_FALSE(counters.available());
+}
+
+// Switches happen in kernel mode: a counter restricted to user space would
+// read 0 here. Each sleep blocks the thread, so each is at least one switch.
+TEST(PerfCountersTest, SleepingCountsContextSwitches) {
+    PerfCounters counters;
+    counters.open();
+    if (!counters.has(PerfCounter::ContextSwitches)) GTEST_SKIP() << "no counters: " << counters.error();
+
+    PerfStats stats;
+    {
+        PerfScope scope(counters, stats);
+        for (int i = 0; i < 5; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_GE(stats.total[PerfCounter::ContextSwitches], 1u);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "core/InputQueue.hpp"
+#include "core/RenderHandoff.hpp"
+#include "core/VirtualClock.hpp"
+
+namespace {
+
+struct TestFrame {
+    std::vector<int> payload;  // Stands in for the copied vertex buffers
+    uint64_t builtFrame = 0;
+};
+
+}  // namespace
+
+TEST(RenderHandoffTest, FramesArriveInOrderAndAreReused) {
+    RenderHandoff<TestFrame> handoff(2);
+    std::vector<uint64_t> presentedOrder;
+    std::vector<const TestFrame*> seen;
+
+    std::thread renderThread([&]() {
+        while (TestFrame* frame = handoff.waitForFrame()) {
+            presentedOrder.push_back(frame->builtFrame);
+            if (std::find(seen.begin(), seen.end(), frame) == seen.end()) seen.push_back(frame);
+            handoff.presented(frame);
+        }
+    });
+
+    std::vector<uint64_t> polled;
+    for (uint64_t i = 1; i <= 200; ++i) {
+        TestFrame* frame = handoff.acquire();
+        ASSERT_NE(frame, nullptr);
+        frame->payload.assign(64, static_cast<int>(i));
+        frame->builtFrame = i;
+        handoff.submit(frame, i);
+        PresentedFrame presented;
+        while (handoff.pollPresented(presented)) polled.push_back(presented.id);
+    }
+    // Drain: once every frame is back in the pool, all were presented
+    std::vector<TestFrame*> drained;
+    for (size_t i = 0; i < handoff.framesInFlight(); ++i) drained.push_back(handoff.acquire());
+    for (TestFrame* frame : drained) handoff.cancel(frame);
+    handoff.stop();
+    renderThread.join();
+    PresentedFrame presented;
+    while (handoff.pollPresented(presented)) polled.push_back(presented.id);
+
+    ASSERT_EQ(presentedOrder.size(), 200u);
+    for (size_t i = 0; i < presentedOrder.size(); ++i) EXPECT_EQ(presentedOrder[i], i + 1);
+    EXPECT_LE(seen.size(), 2u);  // The pool, nothing more
+    ASSERT_FALSE(polled.empty());
+    for (size_t i = 1; i < polled.size(); ++i) EXPECT_GT(polled[i], polled[i - 1]);
+    EXPECT_EQ(handoff.acquireWait().count(), 200u + 2u);
+}
+
+TEST(RenderHandoffTest, MainThreadRunsAtMostFramesInFlightAhead) {
+    for (size_t inFlight : {1u, 3u}) {
+        RenderHandoff<TestFrame> handoff(inFlight);
+        std::atomic<uint64_t> submitted{0};
+        std::atomic<bool> release{false};
+
+        // A render thread stuck before its first present (e.g. in vsync)
+        std::thread renderThread([&]() {
+            TestFrame* first = handoff.waitForFrame();
+            while (!release.load()) std::this_thread::yield();
+            if (first) handoff.presented(first);
+            while (TestFrame* frame = handoff.waitForFrame()) handoff.presented(frame);
+        });
+
+        std::thread mainThread([&]() {
+            for (uint64_t i = 1; i <= 10; ++i) {
+                TestFrame* frame = handoff.acquire();
+                if (!frame) return;
+                handoff.submit(frame, i);
+                submitted.store(i);
+            }
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(submitted.load(), inFlight);
+        release.store(true);
+        mainThread.join();
+        EXPECT_EQ(submitted.load(), 10u);
+        handoff.stop();
+        renderThread.join();
+    }
+}
+
+TEST(RenderHandoffTest, InputPresentLatencyFollowsTheFrameThatCarriedIt) {
+    VirtualClock::reset();
+    BasicInputQueue<VirtualClock> input;
+    auto deliverAll = [&input]() { input.deliverUntil(1e9, [](const InputEvent&) {}); };
+
+    input.push(InputDevice::Key, 1, 1, 0);  // t = 0
+    deliverAll();
+    uint64_t first = input.markSubmitted();
+
+    VirtualClock::advanceSeconds(0.010);
+    input.push(InputDevice::Key, 2, 1, 0);  // t = 10 ms, rides with the next frame
+    deliverAll();
+    uint64_t second = input.markSubmitted();
+
+    // The first frame reaches the screen at 20 ms; the second is still queued
+    input.markPresented(first, 0.020);
+    EXPECT_EQ(input.inputToPresent().count(), 1u);
+    EXPECT_NEAR(input.inputToPresent().maximum(), 20.0, 1e-6);
+
+    input.markPresented(second, 0.036);
+    EXPECT_EQ(input.inputToPresent().count(), 2u);
+    EXPECT_NEAR(input.inputToPresent().maximum(), 26.0, 1e-6);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "core/RenderInterpolation.hpp"
+#include "ecs/Transform.hpp"
+#include "ecs/World.hpp"
+
+namespace {
+
+using C = TransformStreams::Component;
+
+// Deterministic pseudo-random unit quaternions / positions
+struct Lcg {
+    uint32_t state;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 16777216.0f * 2.0f - 1.0f;  // [-1, 1)
+    }
+};
+
+void fill(TransformStreams& s, Lcg& rng) {
+    for (size_t i = 0; i < s.size(); ++i) {
+        for (C c : {C::PX, C::PY, C::PZ, C::SX, C::SY, C::SZ}) s[c][i] = rng.next() * 100.0f;
+
+        float q[4];
+        float lengthSq = 0.0f;
+        for (float& v : q) {
+            v = rng.next();
+            lengthSq += v * v;
+        }
+        float inv = 1.0f / std::sqrt(lengthSq);
+        s[C::QX][i] = q[0] * inv;
+        s[C::QY][i] = q[1] * inv;
+        s[C::QZ][i] = q[2] * inv;
+        s[C::QW][i] = q[3] * inv;
+    }
+}
+
+// Two ticks' worth of random transforms (odd size so every kernel has a tail)
+RenderStateBuffer makeBuffer(size_t n) {
+    Lcg rng{42};
+    RenderStateBuffer buffer;
+    buffer.resize(n);
+    buffer.beginTick();
+    fill(buffer.current(), rng);
+    buffer.beginTick();
+    fill(buffer.current(), rng);
+    return buffer;
+}
+
+}  // namespace
+
+TEST(RenderInterpolationTest, AlphaEndpointsMatchTicks) {
+    RenderStateBuffer buffer = makeBuffer(37);
+    TransformStreams out;
+
+    buffer.interpolate(0.0f, out, interpolationKernels(SimdLevel::Scalar));
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        EXPECT_FLOAT_EQ(out[C::PX][i], buffer.previous()[C::PX][i]);
+        EXPECT_FLOAT_EQ(out[C::SZ][i], buffer.previous()[C::SZ][i]);
+    }
+
+    buffer.interpolate(1.0f, out, interpolationKernels(SimdLevel::Scalar));
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        // a + (b - a) * 1 can be a few ulps off b
+        EXPECT_NEAR(out[C::PY][i], buffer.current()[C::PY][i], 1e-4f);
+        // Same rotation, but nlerp may land on -q when the arc was flipped
+        float dot = 0.0f;
+        for (C c : {C::QX, C::QY, C::QZ, C::QW}) dot += out[c][i] * buffer.current()[c][i];
+        EXPECT_NEAR(std::fabs(dot), 1.0f, 1e-5f);
+    }
+}
+
+TEST(RenderInterpolationTest, RotationsStayUnitAndTakeShortArc) {
+    RenderStateBuffer buffer;
+    buffer.resize(1);
+    buffer.beginTick();
+    TransformStreams& prev = buffer.current();
+    prev[C::QW][0] = 1.0f;  // identity
+    buffer.beginTick();
+    TransformStreams& curr = buffer.current();
+    curr[C::QW][0] = -1.0f;  // also identity, opposite hemisphere
+
+    // Naive lerp would pass through zero at alpha 0.5
+    TransformStreams out;
+    buffer.interpolate(0.5f, out, interpolationKernels(SimdLevel::Scalar));
+    EXPECT_FLOAT_EQ(std::fabs(out[C::QW][0]), 1.0f);
+}
+
+TEST(RenderInterpolationTest, SimdKernelsMatchScalar) {
+    RenderStateBuffer buffer = makeBuffer(1003);
+    TransformStreams expected;
+    buffer.interpolate(0.37f, expected, interpolationKernels(SimdLevel::Scalar));
+
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+        const InterpolationKernels& kernels = interpolationKernels(level);
+        SCOPED_TRACE(kernels.name);
+
+        TransformStreams out;
+        buffer.interpolate(0.37f, out, kernels);
+        for (size_t c = 0; c < TransformStreams::COUNT; ++c) {
+            for (size_t i = 0; i < buffer.size(); ++i) {
+                ASSERT_NEAR(out.streams[c][i], expected.streams[c][i], 1e-4f)
+                    << "component " << c << " index " << i;
+            }
+        }
+    }
+}
+
+TEST(RenderInterpolationTest, UnsupportedLevelFallsBack) {
+    const InterpolationKernels& best = bestInterpolationKernels();
+    EXPECT_EQ(best.level, detectSimdLevel());
+    // Never hands out kernels above what the CPU supports
+    EXPECT_LE(static_cast<int>(interpolationKernels(SimdLevel::AVX2).level),
+              static_cast<int>(detectSimdLevel()));
+}
+
+TEST(RenderInterpolationTest, WorldTransformsFeedTheBufferEveryTick) {
+    World world;
+    RenderStateBuffer buffer;
+    TransformPublisher publisher;
+    Entity a = world.create(Transform{});
+    Entity b = world.create(Transform{});
+    world.create();  // No Transform: not drawn
+    publisher.publish(world, buffer);
+    ASSERT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(publisher.rows(), (std::vector<Entity>{a, b}));
+
+    // Next tick: a moves, rows line up, so render blends
+    world.get<Transform>(a)->position[0] = 10.0f;
+    publisher.publish(world, buffer);
+    TransformStreams out;
+    buffer.interpolate(0.25f, out);
+    EXPECT_FLOAT_EQ(out[C::PX][0], 2.5f);
+    EXPECT_FLOAT_EQ(out[C::QW][1], 1.0f);
+    EXPECT_FLOAT_EQ(out[C::SX][1], 1.0f);
+
+    // a destroyed: b moves into row 0 and must not blend from a's position
+    world.get<Transform>(b)->position[0] = -4.0f;
+    world.destroy(a);
+    publisher.publish(world, buffer);
+    ASSERT_EQ(buffer.size(), 1u);
+    EXPECT_EQ(publisher.rows(), (std::vector<Entity>{b}));
+    buffer.interpolate(0.25f, out);
+    EXPECT_FLOAT_EQ(out[C::PX][0], -4.0f);
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/VirtualClock.hpp"
+#include "net/RollbackSession.hpp"
+#include "net/Transport.hpp"
+#include "net/UdpTransport.hpp"
+#include "sim/RollbackDemo.hpp"
+
+namespace {
+
+using Session = RollbackSession<RollbackDemoGame>;
+
+constexpr double FRAME_SECONDS = 1.0 / 60.0;
+
+// Scripted controller: changes every 7 frames, different per player
+uint32_t scriptedInput(uint32_t player, uint32_t frame) {
+    uint64_t x = (uint64_t{player} << 32 | frame / 7) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<uint32_t>(x >> 60);
+}
+
+RollbackDemoConfig gameConfig(uint32_t players) {
+    RollbackDemoConfig config;
+    config.players = players;
+    config.particles = 256;
+    return config;
+}
+
+// What every peer must end up with: one game fed the true inputs directly
+std::vector<uint64_t> referenceChecksums(uint32_t players, uint32_t inputDelay, size_t frames) {
+    RollbackDemoGame game(gameConfig(players));
+    RollbackDemoGame::State state;
+    std::vector<uint64_t> checksums;
+    std::vector<uint32_t> inputs(players);
+    for (uint32_t f = 0; f < frames; ++f) {
+        game.saveState(state);
+        checksums.push_back(RollbackDemoGame::checksum(state));
+        for (uint32_t p = 0; p < players; ++p) {
+            inputs[p] = f < inputDelay ? 0 : scriptedInput(p, f - inputDelay);
+        }
+        game.step(inputs);
+    }
+    return checksums;
+}
+
+// N peers, each with its own game and session, stepped once per virtual frame
+struct Peers {
+    std::vector<std::unique_ptr<RollbackDemoGame>> games;
+    std::vector<std::unique_ptr<Session>> sessions;
+
+    void add(Transport& transport, RollbackConfig config) {
+        config.localPlayer = transport.localPeer();
+        games.push_back(std::make_unique<RollbackDemoGame>(gameConfig(config.players)));
+        sessions.push_back(std::make_unique<Session>(*games.back(), transport, config));
+    }
+
+    void runFrames(uint32_t frames) {
+        for (uint32_t i = 0; i < frames; ++i) {
+            VirtualClock::advanceSeconds(FRAME_SECONDS);
+            for (auto& session : sessions) {
+                uint32_t player = session->config().localPlayer;
+                session->advanceFrame(scriptedInput(player, session->frame()));
+            }
+        }
+    }
+
+    void expectMatches(const std::vector<uint64_t>& reference, size_t minimumFrames) {
+        for (auto& session : sessions) {
+            const std::vector<uint64_t>& checksums = session->checksums();
+            ASSERT_GE(checksums.size(), minimumFrames);
+            ASSERT_LE(checksums.size(), reference.size());
+            for (size_t f = 0; f < checksums.size(); ++f) {
+                ASSERT_EQ(checksums[f], reference[f]) << "peer " << session->config().localPlayer
+                                                       << " desynced at frame " << f;
+            }
+        }
+    }
+};
+
+}  // namespace
+
+TEST(RollbackTest, PerfectNetworkWithinInputDelayNeverRollsBack) {
+    VirtualClock::reset();
+    LoopbackNetwork<VirtualClock> network(2);
+    Peers peers;
+    for (uint32_t p = 0; p < 2; ++p) peers.add(network.endpoint(p), {});
+
+    peers.runFrames(300);
+
+    peers.expectMatches(referenceChecksums(2, 2, 400), 290);
+    for (auto& session : peers.sessions) {
+        EXPECT_EQ(session->stats().rollbacks, 0u);
+        EXPECT_EQ(session->stats().stalls, 0u);
+        EXPECT_EQ(session->frame(), 300u);
+    }
+}
+
+TEST(RollbackTest, TwoPeersConvergeUnderLatencyJitterAndLoss) {
+    VirtualClock::reset();
+    LinkConditions conditions;
+    conditions.latencySeconds = 0.060;
+    conditions.jitterSeconds = 0.020;
+    conditions.loss = 0.10;
+    LoopbackNetwork<VirtualClock> network(2, conditions);
+
+    RollbackConfig config;
+    config.inputDelay = 1;
+    config.maxPrediction = 12;
+    Peers peers;
+    for (uint32_t p = 0; p < 2; ++p) peers.add(network.endpoint(p), config);
+
+    peers.runFrames(900);
+
+    EXPECT_GT(network.dropped(), 0u);
+    peers.expectMatches(referenceChecksums(2, 1, 1000), 800);
+    for (auto& session : peers.sessions) {
+        const RollbackStats& stats = session->stats();
+        EXPECT_GT(stats.rollbacks, 0u);  // 60 ms > 1 frame of input delay: must predict
+        EXPECT_GE(stats.resimulatedFrames, stats.rollbacks);
+        EXPECT_LE(stats.maxRollbackFrames, config.maxPrediction + 1);
+        EXPECT_GT(stats.resimSeconds, 0.0);
+    }
+}
+
+TEST(RollbackTest, FourPeersStayInSync) {
+    VirtualClock::reset();
+    LinkConditions conditions;
+    conditions.latencySeconds = 0.030;
+    conditions.jitterSeconds = 0.030;
+    conditions.loss = 0.05;
+    conditions.seed = 7;
+    LoopbackNetwork<VirtualClock> network(4, conditions);
+
+    RollbackConfig config;
+    config.players = 4;
+    Peers peers;
+    for (uint32_t p = 0; p < 4; ++p) peers.add(network.endpoint(p), config);
+
+    peers.runFrames(600);
+
+    peers.expectMatches(referenceChecksums(4, config.inputDelay, 700), 500);
+}
+
+TEST(RollbackTest, StallsWhenAPeerGoesSilent) {
+    VirtualClock::reset();
+    LoopbackNetwork<VirtualClock> network(2);
+    RollbackConfig config;
+    config.inputDelay = 2;
+    config.maxPrediction = 8;
+
+    RollbackDemoGame game(gameConfig(2));
+    Session session(game, network.endpoint(0), config);
+
+    // Peer 1 never runs: frames 0..1 are confirmed (input delay), so frames
+    // up to 1 + maxPrediction may run on prediction and then it must wait
+    uint32_t advanced = 0;
+    for (int i = 0; i < 30; ++i) {
+        VirtualClock::advanceSeconds(FRAME_SECONDS);
+        if (session.advanceFrame(0)) ++advanced;
+    }
+    EXPECT_EQ(advanced, config.inputDelay + config.maxPrediction);
+    EXPECT_EQ(session.stats().stalls, 30u - advanced);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(RollbackTest, UdpLocalhostPeersConverge) {
+    VirtualClock::reset();
+    LinkConditions conditions;
+    conditions.latencySeconds = 0.040;
+    conditions.jitterSeconds = 0.010;
+    conditions.loss = 0.05;
+
+    std::vector<std::unique_ptr<UdpTransport<VirtualClock>>> transports;
+    std::vector<uint16_t> ports;
+    for (uint32_t p = 0; p < 2; ++p) {
+        conditions.seed = p + 1;
+        transports.push_back(std::make_unique<UdpTransport<VirtualClock>>(p, conditions));
+        ASSERT_TRUE(transports.back()->open(0));
+        ports.push_back(transports.back()->port());
+    }
+
+    Peers peers;
+    for (auto& transport : transports) {
+        transport->setPeerPorts(ports);
+        peers.add(*transport, {});
+    }
+
+    peers.runFrames(400);
+
+    peers.expectMatches(referenceChecksums(2, 2, 500), 300);
+}
+#endif
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "core/Seqlock.hpp"
+#include "core/TimingStatus.hpp"
+
+namespace {
+
+// Every field derives from one counter, so a torn read breaks the invariant
+struct Payload {
+    uint64_t counter = 0;
+    uint64_t doubled = 0;
+    uint64_t inverted = ~uint64_t{0};
+    double asDouble = 0.0;
+    float asFloat = 0.0f;
+    bool odd = false;
+};
+
+Payload makePayload(uint64_t i) {
+    return {i, i * 2, ~i, static_cast<double>(i), static_cast<float>(i % 1000), (i & 1) != 0};
+}
+
+bool consistent(const Payload& p) {
+    return p.doubled == p.counter * 2 && p.inverted == ~p.counter &&
+           p.asDouble == static_cast<double>(p.counter) &&
+           p.asFloat == static_cast<float>(p.counter % 1000) && p.odd == ((p.counter & 1) != 0);
+}
+
+}  // namespace
+
+TEST(SeqlockTest, StoreThenLoad) {
+    Seqlock<Payload> lock;
+    EXPECT_EQ(lock.version(), 1u);
+    lock.store(makePayload(42));
+    EXPECT_EQ(lock.version(), 2u);
+    Payload p = lock.load();
+    EXPECT_EQ(p.counter, 42u);
+    EXPECT_TRUE(consistent(p));
+}
+
+TEST(SeqlockTest, ManyReadersNeverSeeTornValues) {
+    constexpr int READERS = 8;
+    constexpr uint64_t WRITES = 200'000;
+
+    Seqlock<Payload> lock;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> backwards{0};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<int> overlapped{0};  // Readers that saw an intermediate value
+    std::atomic<int> started{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; ++r) {
+        readers.emplace_back([&]() {
+            uint64_t last = 0;
+            uint64_t count = 0;
+            bool sawMiddle = false;
+            started.fetch_add(1);
+            while (!done.load(std::memory_order_acquire)) {
+                Payload p = lock.load();
+                if (!consistent(p)) torn.fetch_add(1);
+                if (p.counter < last) backwards.fetch_add(1);  // Single writer: monotonic
+                if (p.counter > 1 && p.counter < WRITES) sawMiddle = true;
+                last = p.counter;
+                ++count;
+            }
+            // Saw something other than the initial or the final value
+            if (sawMiddle) overlapped.fetch_add(1);
+            reads.fetch_add(count);
+        });
+    }
+
+    // Don't finish before the readers are running (matters on few cores)
+    while (started.load() < READERS) std::this_thread::yield();
+    for (uint64_t i = 1; i <= WRITES; ++i) {
+        lock.store(makePayload(i));
+        if (i % 4096 == 0) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    for (std::thread& reader : readers) reader.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(backwards.load(), 0);
+    EXPECT_GT(reads.load(), 0u);
+    EXPECT_GT(overlapped.load(), 0);  // Reads really ran while writes did
+    EXPECT_EQ(lock.load().counter, WRITES);
+    EXPECT_EQ(lock.version(), WRITES + 1);
+}
+
+TEST(SeqlockTest, TimingStatusReflectsLoopState) {
+    TimeController time;
+    GameLoop loop(time);
+    FrametimeHistory history;
+    for (int i = 0; i < 10; ++i) {
+        history.push(16.0f);
+        loop.advance(1.0 / 60.0, [](double) {});
+    }
+    time.pause();
+    time.setTimeScale(0.5f);
+
+    TimingStatusPublisher publisher;
+    publisher.store(captureTimingStatus(10, 16.0f, history, time, loop));
+
+    // Read from another thread, as a watchdog would
+    TimingStatus status;
+    std::thread reader([&]() { status = publisher.load(); });
+    reader.join();
+
+    EXPECT_EQ(status.frame, 10u);
+    EXPECT_EQ(status.tick, loop.tick());
+    EXPECT_FLOAT_EQ(status.medianMs, 16.0f);
+    EXPECT_TRUE(status.paused);
+    EXPECT_FLOAT_EQ(status.timeScale, 0.5f);
+}
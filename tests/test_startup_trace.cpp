@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <future>
+#include <string>
+
+#include "core/StartupTrace.hpp"
+
+TEST(StartupTraceTest, RecordsPhasesFromSeveralThreads) {
+    StartupTrace trace;
+    {
+        StartupTrace::Scope phase(trace, "main work");
+    }
+    auto worker = std::async(std::launch::async, [&trace]() {
+        StartupTrace::Scope phase(trace, "worker work");
+    });
+    worker.get();
+
+    std::vector<StartupPhase> phases = trace.phases();
+    ASSERT_EQ(phases.size(), 2u);
+    EXPECT_STREQ(phases[0].name, "main work");
+    EXPECT_EQ(phases[0].thread, 0u);
+    EXPECT_STREQ(phases[1].name, "worker work");
+    EXPECT_EQ(phases[1].thread, 1u);
+    EXPECT_LE(phases[0].startSeconds, phases[1].startSeconds);
+    EXPECT_GE(phases[1].seconds(), 0.0);
+}
+
+TEST(StartupTraceTest, FirstFrameIsMarkedOnce) {
+    StartupTrace trace;
+    EXPECT_LT(trace.timeToFirstFrame(), 0.0);
+    EXPECT_EQ(trace.report().find("first frame"), std::string::npos);
+
+    trace.markFirstFrame();
+    double first = trace.timeToFirstFrame();
+    EXPECT_GE(first, 0.0);
+    trace.markFirstFrame();
+    EXPECT_EQ(trace.timeToFirstFrame(), first);
+
+    trace.record("settings parse", 0.001, 0.003);
+    std::string report = trace.report();
+    EXPECT_NE(report.find("settings parse"), std::string::npos);
+    EXPECT_NE(report.find("Time to first frame"), std::string::npos);
+}
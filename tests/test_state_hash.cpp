@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "core/HashLog.hpp"
+#include "core/StateHash.hpp"
+#include "sim/DemoSimulation.hpp"
+
+namespace {
+
+HashLog record(const DemoSimulationConfig& config, int ticks) {
+    DemoSimulation sim(config);
+    HashLog log(DemoSimulation::subsystemNames());
+    std::array<uint64_t, DemoSimulation::SUBSYSTEMS.size()> hashes{};
+    for (int i = 0; i < ticks; ++i) {
+        sim.fixedUpdate(1.0 / 60.0);
+        sim.hashState(hashes);
+        log.append(sim.tick(), hashes);
+    }
+    return log;
+}
+
+}  // namespace
+
+TEST(StateHashTest, IncrementalMatchesOneShot) {
+    std::vector<unsigned char> data(1000);
+    std::iota(data.begin(), data.end(), static_cast<unsigned char>(0));
+    uint64_t oneShot = StateHasher::hash(data.data(), data.size());
+
+    // Feed the same bytes in awkward chunk sizes
+    StateHasher hasher;
+    size_t offset = 0;
+    for (size_t chunk : {1u, 7u, 64u, 65u, 3u, 500u}) {
+        hasher.update(data.data() + offset, chunk);
+        offset += chunk;
+    }
+    hasher.update(data.data() + offset, data.size() - offset);
+
+    EXPECT_EQ(hasher.digest(), oneShot);
+}
+
+TEST(StateHashTest, SingleBitFlipChangesHash) {
+    std::vector<unsigned char> data(4096, 0xAB);
+    uint64_t before = StateHasher::hash(data.data(), data.size());
+    data[2049] ^= 0x10;
+    EXPECT_NE(StateHasher::hash(data.data(), data.size()), before);
+
+    // Length is part of the hash (trailing zeros are not ignored)
+    std::vector<unsigned char> zeros(10, 0);
+    EXPECT_NE(StateHasher::hash(zeros.data(), 9), StateHasher::hash(zeros.data(), 10));
+}
+
+TEST(HashLogTest, ThreadCountDoesNotChangeSimulation) {
+    DemoSimulationConfig single;
+    single.particles = 2000;
+    DemoSimulationConfig quad = single;
+    quad.threads = 4;
+
+    EXPECT_FALSE(findFirstDesync(record(single, 300), record(quad, 300)).has_value());
+}
+
+TEST(HashLogTest, ReportsFirstDivergingTickAndSubsystem) {
+    DemoSimulationConfig clean;
+    clean.particles = 500;
+    DemoSimulationConfig perturbed = clean;
+    perturbed.perturbAtTick = 123;
+
+    std::optional<Desync> desync = findFirstDesync(record(clean, 300), record(perturbed, 300));
+
+    ASSERT_TRUE(desync.has_value());
+    EXPECT_EQ(desync->tick, 123u);
+    EXPECT_EQ(desync->subsystem, "particles");
+}
+
+TEST(HashLogTest, SaveAndLoadRoundTrip) {
+    DemoSimulationConfig config;
+    config.particles = 100;
+    HashLog log = record(config, 50);
+    log.setConfig("particles=100 seed=1");
+
+    std::string path = ::testing::TempDir() + "roundtrip.hlog";
+    ASSERT_TRUE(log.save(path));
+    std::optional<HashLog> loaded = HashLog::load(path);
+    std::remove(path.c_str());
+
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->size(), 50u);
+    EXPECT_EQ(loaded->subsystems(), log.subsystems());
+    EXPECT_EQ(loaded->config(), "particles=100 seed=1");
+    EXPECT_FALSE(findFirstDesync(log, *loaded).has_value());
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "core/GameLoop.hpp"
+#include "core/TimingWheel.hpp"
+
+TEST(TimingWheelTest, FiresOnExactTick) {
+    TimingWheel wheel;
+    std::vector<uint64_t> firedAt;
+    for (uint64_t delay : {1u, 2u, 63u, 64u, 65u, 4095u, 4096u, 4097u, 300000u}) {
+        wheel.schedule(delay, [&]() { firedAt.push_back(wheel.now()); });
+    }
+
+    while (!wheel.empty()) wheel.advance();
+
+    EXPECT_EQ(firedAt, (std::vector<uint64_t>{1, 2, 63, 64, 65, 4095, 4096, 4097, 300000}));
+}
+
+TEST(TimingWheelTest, MatchesReferenceForRandomDelays) {
+    TimingWheel wheel;
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<uint64_t> delays(0, 20000);
+
+    std::vector<uint64_t> expected(5000);
+    std::vector<uint64_t> actual(5000, 0);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        uint64_t delay = delays(rng);
+        expected[i] = delay == 0 ? 1 : delay;
+        wheel.schedule(delay, [&actual, &wheel, i]() { actual[i] = wheel.now(); });
+    }
+
+    while (!wheel.empty()) wheel.advance();
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(TimingWheelTest, CancelPreventsFiring) {
+    TimingWheel wheel;
+    int fired = 0;
+    TimerHandle keep = wheel.schedule(10, [&]() { ++fired; });
+    TimerHandle drop = wheel.schedule(10, [&]() { fired += 100; });
+
+    EXPECT_TRUE(wheel.cancel(drop));
+    EXPECT_FALSE(wheel.cancel(drop));  // Already cancelled
+    EXPECT_EQ(wheel.size(), 1u);
+
+    for (int i = 0; i < 10; ++i) wheel.advance();
+
+    EXPECT_EQ(fired, 1);
+    EXPECT_FALSE(wheel.isPending(keep));
+    EXPECT_FALSE(wheel.cancel(keep));  // Already fired
+}
+
+TEST(TimingWheelTest, StaleHandleDoesNotCancelRecycledTimer) {
+    TimingWheel wheel;
+    TimerHandle first = wheel.schedule(1, []() {});
+    wheel.advance();
+
+    bool fired = false;
+    TimerHandle second = wheel.schedule(1, [&]() { fired = true; });
+    EXPECT_EQ(first.index, second.index);  // Node was recycled
+    EXPECT_FALSE(wheel.cancel(first));
+
+    wheel.advance();
+    EXPECT_TRUE(fired);
+}
+
+TEST(TimingWheelTest, CallbackCanRescheduleAndCancel) {
+    TimingWheel wheel;
+    int repeats = 0;
+    TimerHandle victim = wheel.schedule(3, [&]() { repeats += 100; });
+
+    std::function<void()> repeat = [&]() {
+        ++repeats;
+        wheel.cancel(victim);
+        if (repeats < 5) wheel.schedule(1, repeat);
+    };
+    wheel.schedule(1, repeat);
+
+    for (int i = 0; i < 10; ++i) wheel.advance();
+
+    EXPECT_EQ(repeats, 5);
+}
+
+TEST(TimingWheelTest, FreezesWhilePausedAndFiresOnStep) {
+    TimeController time;
+    GameLoop loop(time);
+    TimingWheel wheel;
+    int fired = 0;
+    wheel.schedule(2, [&]() { ++fired; });
+    auto fixedUpdate = [&](double) { wheel.advance(); };
+
+    time.pause();
+    loop.advance(1.0, fixedUpdate);
+    EXPECT_EQ(wheel.now(), 0u);
+
+    time.step();
+    loop.advance(GameLoop::DEFAULT_FIXED_DT, fixedUpdate);
+    EXPECT_EQ(fired, 0);
+
+    time.step();
+    loop.advance(GameLoop::DEFAULT_FIXED_DT, fixedUpdate);
+    EXPECT_EQ(fired, 1);
+    EXPECT_EQ(wheel.now(), loop.tick());
+}
+
+TEST(TimingWheelTest, FiresEachTimerWhenManyTicksRunInOneFrame) {
+    TimeController time;
+    GameLoop loop(time);
+    TimingWheel wheel;
+    std::vector<uint64_t> firedAt;
+    for (uint64_t delay = 1; delay <= 10; ++delay) {
+        wheel.schedule(delay, [&]() { firedAt.push_back(wheel.now()); });
+    }
+
+    // 10 ticks worth of time in a single frame (plus a little, to avoid
+    // landing exactly on the accumulator boundary)
+    int ticks = loop.advance(GameLoop::DEFAULT_FIXED_DT * 10.5, [&](double) { wheel.advance(); });
+
+    EXPECT_EQ(ticks, 10);
+    EXPECT_EQ(firedAt, (std::vector<uint64_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "core/GameLoop.hpp"
+#include "core/Timer.hpp"
+#include "core/VirtualClock.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+using VirtualTimer = BasicTimer<VirtualClock>;
+using VirtualGameLoop = BasicGameLoop<VirtualClock>;
+
+auto noop = [](double) {};
+
+// The main loop, minus the window: measure the frame, then advance the loop
+struct Harness {
+    TimeController time;
+    VirtualGameLoop loop{time};
+    VirtualTimer frameTimer;
+    uint64_t frames = 0;
+
+    Harness() { VirtualClock::reset(); frameTimer.rest(); }
+
+    int frame(std::chrono::nanoseconds frameCost) {
+        VirtualClock::advance(frameCost);
+        ++frames;
+        return loop.advance(frameTimer.lap(), noop);
+    }
+};
+
+constexpr std::chrono::nanoseconds FRAME_60HZ{16'666'667};
+
+}  // namespace
+
+TEST(VirtualClockTest, TimersMeasureOnlyVirtualTime) {
+    VirtualClock::reset();
+    VirtualTimer timer;
+    EXPECT_EQ(timer.elapsed(), 0.0);
+
+    VirtualClock::advance(250ms);
+    EXPECT_DOUBLE_EQ(timer.elapsed(), 0.25);
+    EXPECT_DOUBLE_EQ(timer.lap(), 0.25);
+    EXPECT_EQ(timer.elapsed(), 0.0);
+
+    VirtualClock::advance(-1s);  // Steady: never goes backwards
+    EXPECT_EQ(timer.elapsed(), 0.0);
+
+    double scoped = 0.0;
+    {
+        BasicScopedTimer<VirtualClock> measure(scoped);
+        VirtualClock::advanceSeconds(3.5);
+    }
+    EXPECT_DOUBLE_EQ(scoped, 3.5);
+}
+
+TEST(VirtualClockTest, TenHoursAtSixtyHzStayInLockstep) {
+    Harness h;
+    const uint64_t frames = 10ull * 3600 * 60;
+    uint64_t ticks = 0;
+    for (uint64_t i = 0; i < frames; ++i) ticks += static_cast<uint64_t>(h.frame(FRAME_60HZ));
+
+    // One tick per frame on average: no drift over 10 hours
+    EXPECT_NEAR(static_cast<double>(ticks), static_cast<double>(frames), 2.0);
+    EXPECT_EQ(h.loop.droppedTime(), 0.0);
+    EXPECT_LT(h.loop.accumulator(), h.loop.fixedDt());
+}
+
+TEST(VirtualClockTest, HourlySpikesAreCappedAndAccounted) {
+    Harness h;
+    uint64_t ticks = 0;
+    // 3 hours of 144 Hz frames with a 3 s spike at the top of each hour
+    const uint64_t framesPerHour = 3600ull * 144;
+    for (int hour = 0; hour < 3; ++hour) {
+        int spikeTicks = h.frame(3s);
+        EXPECT_EQ(spikeTicks, 15);  // 0.25 s cap
+        ticks += static_cast<uint64_t>(spikeTicks);
+        for (uint64_t i = 0; i < framesPerHour; ++i) {
+            ticks += static_cast<uint64_t>(h.frame(std::chrono::nanoseconds(6'944'444)));
+        }
+    }
+    EXPECT_NEAR(h.loop.droppedTime(), 3 * 2.75, 1e-9);
+
+    // Simulated time = wall time - dropped time
+    double wall = std::chrono::duration<double>(VirtualClock::now().time_since_epoch()).count();
+    double simulated = static_cast<double>(ticks) * h.loop.fixedDt();
+    EXPECT_NEAR(simulated, wall - h.loop.droppedTime(), h.loop.fixedDt());
+}
+
+TEST(VirtualClockTest, ClockStallThenJump) {
+    Harness h;
+    for (int i = 0; i < 60; ++i) h.frame(FRAME_60HZ);
+    uint64_t before = h.loop.tick();
+
+    // A clock that stops (suspended VM, broken timer source): zero-length frames
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(h.frame(0ns), 0);
+    EXPECT_EQ(h.loop.tick(), before);
+
+    // ...then catches up 40 s at once: capped, not replayed
+    EXPECT_EQ(h.frame(40s), 15);
+    EXPECT_NEAR(h.loop.droppedTime(), 39.75, 1e-9);
+    EXPECT_EQ(h.frame(FRAME_60HZ), 1);
+}
+
+TEST(VirtualClockTest, LongPauseWithStepsDoesNotBankTime) {
+    Harness h;
+    for (int i = 0; i < 60; ++i) h.frame(FRAME_60HZ);
+    uint64_t before = h.loop.tick();
+    double accumulator = h.loop.accumulator();
+
+    // Paused for 2 hours, stepping once a minute
+    h.time.pause();
+    const int framesPerMinute = 60 * 60;
+    for (int minute = 0; minute < 120; ++minute) {
+        h.time.step();
+        for (int i = 0; i < framesPerMinute; ++i) h.frame(FRAME_60HZ);
+    }
+    EXPECT_EQ(h.loop.tick(), before + 120);
+    EXPECT_EQ(h.loop.accumulator(), accumulator);
+    EXPECT_EQ(h.loop.droppedTime(), 0.0);
+
+    // Resuming runs at normal pace (no 2-hour catch-up burst)
+    h.time.resume();
+    EXPECT_EQ(h.frame(FRAME_60HZ), 1);
+}
+
+TEST(VirtualClockTest, SlowMotionOverAnHour) {
+    Harness h;
+    h.time.setTimeScale(0.25f);
+    uint64_t ticks = 0;
+    for (int i = 0; i < 3600 * 60; ++i) ticks += static_cast<uint64_t>(h.frame(FRAME_60HZ));
+    EXPECT_NEAR(static_cast<double>(ticks), 3600.0 * 60.0 * 0.25, 2.0);
+}
+
+TEST(VirtualClockTest, TurboSliceCountsTicksByTheirVirtualCost) {
+    VirtualClock::reset();
+    TimeController time;
+    time.setTurbo(true);
+    VirtualGameLoop loop(time);
+
+    // Each update "costs" 1 ms: a 1/60 s slice fits exactly 17 of them
+    int ticks = loop.advanceTurbo(0.0, 1.0 / 60.0, [](double) { VirtualClock::advance(1ms); });
+    EXPECT_EQ(ticks, 17);
+}